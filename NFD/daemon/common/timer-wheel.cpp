@@ -0,0 +1,299 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "timer-wheel.hpp"
+
+#include <ns3/simulator.h>
+
+namespace nfd {
+
+const time::nanoseconds TimerWheel::DEFAULT_TICK = 100_us;
+
+constexpr size_t TimerWheel::N_LEVELS;
+constexpr size_t TimerWheel::SLOT_BITS;
+constexpr size_t TimerWheel::N_SLOTS;
+constexpr size_t TimerWheel::SLOT_MASK;
+constexpr uint32_t TimerWheel::NONE;
+
+bool
+TimerWheel::EventId::cancel()
+{
+  return m_wheel != nullptr && m_wheel->cancel(m_index, m_generation);
+}
+
+TimerWheel::EventId::operator bool() const
+{
+  return m_wheel != nullptr && m_wheel->isPending(m_index, m_generation);
+}
+
+TimerWheel::TimerWheel(time::nanoseconds tick)
+  : m_tick(tick)
+  , m_current(0)
+{
+  BOOST_ASSERT(tick > 0_ns);
+}
+
+TimerWheel::~TimerWheel()
+{
+  if (m_isArmed) {
+    m_event.Cancel();
+  }
+}
+
+TimerWheel::Tick
+TimerWheel::getNowTick() const
+{
+  auto now = time::duration_cast<time::nanoseconds>(time::steady_clock::now().time_since_epoch());
+  return static_cast<Tick>(now.count() / m_tick.count());
+}
+
+TimerWheel::EventId
+TimerWheel::schedule(time::nanoseconds after, Callback callback)
+{
+  BOOST_ASSERT(callback != nullptr);
+
+  if (m_nPending == 0) {
+    // nothing is linked, so the wheel can be rotated to the present for free
+    m_current = std::max(m_current, this->getNowTick());
+  }
+
+  auto now = time::duration_cast<time::nanoseconds>(time::steady_clock::now().time_since_epoch());
+  auto at = now + std::max(after, 0_ns);
+  Tick deadline = static_cast<Tick>((at.count() + m_tick.count() - 1) / m_tick.count());
+  // never fire from within schedule(), and stay within the span of the top level
+  deadline = std::max(deadline, m_current + 1);
+  deadline = std::min(deadline, m_current + (Tick(1) << (SLOT_BITS * N_LEVELS)) - 1);
+
+  uint32_t index = 0;
+  if (m_freeList.empty()) {
+    index = static_cast<uint32_t>(m_timers.size());
+    m_timers.emplace_back();
+  }
+  else {
+    index = m_freeList.back();
+    m_freeList.pop_back();
+  }
+
+  Timer& timer = m_timers[index];
+  timer.callback = std::move(callback);
+  timer.deadline = deadline;
+  timer.isPending = true;
+  this->place(index);
+  ++m_nPending;
+  ++m_counters.nScheduled;
+
+  this->arm();
+  return EventId(*this, index, timer.generation);
+}
+
+bool
+TimerWheel::cancel(uint32_t index, uint32_t generation)
+{
+  if (!this->isPending(index, generation)) {
+    return false;
+  }
+
+  this->unlink(index);
+  this->release(index);
+  ++m_counters.nCancelled;
+  // an armed event that finds no work is cheaper than re-arming on every cancellation
+  return true;
+}
+
+void
+TimerWheel::place(uint32_t index)
+{
+  Timer& timer = m_timers[index];
+  Tick delta = timer.deadline - m_current;
+
+  size_t level = 0;
+  while (level < N_LEVELS - 1 && delta >= (Tick(1) << (SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+  size_t slotIndex = (timer.deadline >> (SLOT_BITS * level)) & SLOT_MASK;
+  timer.slot = static_cast<uint16_t>(level * N_SLOTS + slotIndex);
+
+  Slot& slot = m_slots[timer.slot];
+  timer.prev = slot.tail;
+  timer.next = NONE;
+  if (slot.tail == NONE) {
+    slot.head = index;
+    m_occupied[level][slotIndex / 64] |= uint64_t(1) << (slotIndex % 64);
+  }
+  else {
+    m_timers[slot.tail].next = index;
+  }
+  slot.tail = index;
+}
+
+void
+TimerWheel::unlink(uint32_t index)
+{
+  Timer& timer = m_timers[index];
+  Slot& slot = m_slots[timer.slot];
+
+  if (timer.prev == NONE) {
+    slot.head = timer.next;
+  }
+  else {
+    m_timers[timer.prev].next = timer.next;
+  }
+  if (timer.next == NONE) {
+    slot.tail = timer.prev;
+  }
+  else {
+    m_timers[timer.next].prev = timer.prev;
+  }
+
+  if (slot.head == NONE) {
+    size_t level = timer.slot / N_SLOTS;
+    size_t slotIndex = timer.slot % N_SLOTS;
+    m_occupied[level][slotIndex / 64] &= ~(uint64_t(1) << (slotIndex % 64));
+  }
+  timer.prev = timer.next = NONE;
+}
+
+void
+TimerWheel::release(uint32_t index)
+{
+  Timer& timer = m_timers[index];
+  timer.callback = nullptr;
+  timer.isPending = false;
+  ++timer.generation;
+  m_freeList.push_back(index);
+  BOOST_ASSERT(m_nPending > 0);
+  --m_nPending;
+}
+
+size_t
+TimerWheel::findNextSlot(size_t level, size_t from) const
+{
+  const auto& occupied = m_occupied[level];
+  for (size_t k = 1; k <= N_SLOTS;) {
+    size_t slotIndex = (from + k) & SLOT_MASK;
+    uint64_t word = occupied[slotIndex / 64] >> (slotIndex % 64);
+    if (word != 0) {
+      size_t distance = k + __builtin_ctzll(word);
+      return distance <= N_SLOTS ? distance : 0;
+    }
+    k += 64 - slotIndex % 64;
+  }
+  return 0;
+}
+
+optional<TimerWheel::Tick>
+TimerWheel::findNextTick() const
+{
+  optional<Tick> next;
+  for (size_t level = 0; level < N_LEVELS; ++level) {
+    size_t shift = SLOT_BITS * level;
+    size_t distance = this->findNextSlot(level, (m_current >> shift) & SLOT_MASK);
+    if (distance == 0) {
+      continue;
+    }
+
+    // a timer fires at its level-0 slot; higher-level slots are cascaded when they come around
+    Tick tick = level == 0 ? m_current + distance : ((m_current >> shift) + distance) << shift;
+    if (!next || tick < *next) {
+      next = tick;
+    }
+  }
+  return next;
+}
+
+void
+TimerWheel::processTick(Tick tick)
+{
+  m_current = tick;
+
+  // cascade from the top, so that timers can move down more than one level in the same tick
+  for (size_t level = N_LEVELS - 1; level > 0; --level) {
+    size_t shift = SLOT_BITS * level;
+    if ((tick & ((Tick(1) << shift) - 1)) != 0) {
+      continue;
+    }
+
+    size_t slotIndex = (tick >> shift) & SLOT_MASK;
+    Slot& slot = m_slots[level * N_SLOTS + slotIndex];
+    uint32_t index = slot.head;
+    slot.head = slot.tail = NONE;
+    m_occupied[level][slotIndex / 64] &= ~(uint64_t(1) << (slotIndex % 64));
+
+    while (index != NONE) {
+      uint32_t next = m_timers[index].next;
+      this->place(index);
+      ++m_counters.nCascaded;
+      index = next;
+    }
+  }
+
+  Slot& slot = m_slots[tick & SLOT_MASK];
+  while (slot.head != NONE) {
+    uint32_t index = slot.head;
+    this->unlink(index);
+    Callback callback = std::move(m_timers[index].callback);
+    this->release(index);
+    ++m_counters.nFired;
+    // the callback may schedule or cancel timers, which may reallocate m_timers
+    callback();
+  }
+}
+
+void
+TimerWheel::onTimerEvent()
+{
+  m_isArmed = false;
+  ++m_counters.nTicks;
+
+  Tick target = m_eventTick;
+  for (auto next = this->findNextTick(); next && *next <= target; next = this->findNextTick()) {
+    this->processTick(*next);
+  }
+  // there is no work in the skipped ticks
+  m_current = std::max(m_current, target);
+
+  this->arm();
+}
+
+void
+TimerWheel::arm()
+{
+  auto next = this->findNextTick();
+  if (!next || (m_isArmed && m_eventTick <= *next)) {
+    return;
+  }
+
+  if (m_isArmed) {
+    m_event.Cancel();
+  }
+  m_eventTick = *next;
+  m_isArmed = true;
+
+  auto now = time::duration_cast<time::nanoseconds>(time::steady_clock::now().time_since_epoch());
+  auto delay = std::max(time::nanoseconds(static_cast<int64_t>(*next) * m_tick.count()) - now, 0_ns);
+  m_event = ns3::Simulator::Schedule(ns3::NanoSeconds(delay.count()), &TimerWheel::onTimerEvent, this);
+}
+
+} // namespace nfd
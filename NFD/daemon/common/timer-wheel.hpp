@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+#define NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+
+#include "common/counter.hpp"
+
+#include <ns3/event-id.h>
+
+#include <array>
+
+namespace nfd {
+
+/** \brief a per-node hierarchical timing wheel for forwarding timers
+ *
+ *  Timers are rounded up to a tick and kept in four levels of 256 slots, each level covering
+ *  256 times the span of the level below. A timer is placed in the lowest level whose span
+ *  covers its remaining delay, and is cascaded into lower levels as its deadline approaches.
+ *  Slots are intrusive doubly-linked lists over a pool of timer records, so that scheduling
+ *  and cancellation take constant time.
+ *
+ *  The wheel holds at most one ns-3 event, armed for the next tick that has timers to fire or
+ *  to cascade. All timers due in that tick are processed in the same ns-3 event, in the order
+ *  they were scheduled. Ticks without work are skipped.
+ */
+class TimerWheel : noncopyable
+{
+public:
+  using Callback = std::function<void()>;
+
+  /** \brief identifies a timer scheduled on a TimerWheel
+   *
+   *  An EventId is a plain value. It does not cancel the timer when destroyed, and it remains
+   *  safe to use after the timer has fired or has been cancelled.
+   */
+  class EventId
+  {
+  public:
+    EventId() = default;
+
+    /** \brief cancel the timer
+     *  \return whether the timer was pending
+     */
+    bool
+    cancel();
+
+    /** \return whether the timer is still pending
+     */
+    explicit
+    operator bool() const;
+
+  private:
+    EventId(TimerWheel& wheel, uint32_t index, uint32_t generation)
+      : m_wheel(&wheel)
+      , m_index(index)
+      , m_generation(generation)
+    {
+    }
+
+  private:
+    TimerWheel* m_wheel = nullptr;
+    uint32_t m_index = 0;
+    uint32_t m_generation = 0;
+
+    friend class TimerWheel;
+  };
+
+  class Counters
+  {
+  public:
+    PacketCounter nScheduled; ///< timers scheduled
+    PacketCounter nCancelled; ///< timers cancelled before firing
+    PacketCounter nFired;     ///< timers fired
+    PacketCounter nCascaded;  ///< timers moved into a lower level
+    PacketCounter nTicks;     ///< ns-3 events processed by the wheel
+  };
+
+  explicit
+  TimerWheel(time::nanoseconds tick = DEFAULT_TICK);
+
+  ~TimerWheel();
+
+  /** \brief schedule \p callback to be invoked after \p after
+   *
+   *  The callback is invoked at the first tick boundary at or after the deadline,
+   *  and never from within this function.
+   */
+  EventId
+  schedule(time::nanoseconds after, Callback callback);
+
+  /** \return number of pending timers
+   */
+  size_t
+  size() const
+  {
+    return m_nPending;
+  }
+
+  time::nanoseconds
+  getTick() const
+  {
+    return m_tick;
+  }
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
+public:
+  static const time::nanoseconds DEFAULT_TICK;
+
+private:
+  using Tick = uint64_t;
+
+  static constexpr size_t N_LEVELS = 4;
+  static constexpr size_t SLOT_BITS = 8;
+  static constexpr size_t N_SLOTS = 1 << SLOT_BITS;
+  static constexpr size_t SLOT_MASK = N_SLOTS - 1;
+  static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+  struct Timer
+  {
+    Callback callback;
+    Tick deadline = 0;
+    uint32_t prev = NONE;
+    uint32_t next = NONE;
+    uint32_t generation = 0;
+    uint16_t slot = 0; ///< level * N_SLOTS + slot index
+    bool isPending = false;
+  };
+
+  struct Slot
+  {
+    uint32_t head = NONE;
+    uint32_t tail = NONE;
+  };
+
+  Tick
+  getNowTick() const;
+
+  bool
+  isPending(uint32_t index, uint32_t generation) const
+  {
+    return index < m_timers.size() && m_timers[index].generation == generation &&
+           m_timers[index].isPending;
+  }
+
+  bool
+  cancel(uint32_t index, uint32_t generation);
+
+  /** \brief link timer \p index into the slot matching its deadline, relative to m_current
+   */
+  void
+  place(uint32_t index);
+
+  void
+  unlink(uint32_t index);
+
+  void
+  release(uint32_t index);
+
+  /** \brief find the next non-empty slot of \p level after \p from, going around once
+   *  \return distance in slots within [1, N_SLOTS], or 0 if the level is empty
+   */
+  size_t
+  findNextSlot(size_t level, size_t from) const;
+
+  /** \return the next tick after m_current that has timers to fire or cascade,
+   *          or nullopt if there are no timers
+   */
+  optional<Tick>
+  findNextTick() const;
+
+  void
+  processTick(Tick tick);
+
+  void
+  onTimerEvent();
+
+  /** \brief arm the ns-3 event for the next tick with work, if it is not already armed earlier
+   */
+  void
+  arm();
+
+private:
+  const time::nanoseconds m_tick;
+  Tick m_current;
+
+  std::vector<Timer> m_timers;
+  std::vector<uint32_t> m_freeList;
+  std::array<Slot, N_LEVELS * N_SLOTS> m_slots;
+  std::array<std::array<uint64_t, N_SLOTS / 64>, N_LEVELS> m_occupied{};
+  size_t m_nPending = 0;
+
+  ns3::EventId m_event;
+  Tick m_eventTick = 0;
+  bool m_isArmed = false;
+
+  Counters m_counters;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
@@ -30,6 +30,7 @@
 #include "common/logger.hpp"
 
 #include <ndn-cxx/encoding/nfd-constants.hpp>
+#include <ndn-cxx/lp/geo-tag.hpp>
 
 #include <boost/logic/tribool.hpp>
 
@@ -80,6 +81,20 @@ struct FaceParams
   boost::logic::tribool wantCongestionMarking = boost::logic::indeterminate;
 };
 
+/** \brief Link-layer fields that describe one transmission of a network-layer packet.
+ *
+ *  These fields are passed alongside the packet rather than as tags on it, because a packet may be
+ *  shared with the ContentStore or a timer and sent on several faces, each time with its own
+ *  fields. A field that is set here takes precedence over the corresponding tag on the packet.
+ */
+struct EgressFields
+{
+  /// position of the transmitting node; the tag is expected to hold its wire encoding already
+  shared_ptr<const ndn::lp::GeoTag> geoTag;
+  /// egress priority, smaller values being more urgent
+  optional<uint64_t> priority;
+};
+
 /** \brief For internal use by FaceLogging macros.
  *
  *  FaceLogHelper wraps a reference to Face, LinkService, or Transport object.
@@ -104,6 +119,7 @@ public:
 
 } // namespace face
 
+using face::EgressFields;
 using face::EndpointId;
 using face::FaceId;
 
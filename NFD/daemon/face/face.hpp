@@ -67,9 +67,10 @@ public: // upper interface connected to forwarding
   sendInterest(const Interest& interest, const EndpointId& endpointId);
 
   /** \brief send Data to \p endpointId
+   *  \param fields link-layer fields of this transmission only
    */
   void
-  sendData(const Data& data, const EndpointId& endpointId);
+  sendData(const Data& data, const EndpointId& endpointId, const EgressFields& fields = {});
 
   /** \brief send Nack to \p endpointId
    */
@@ -199,9 +200,9 @@ Face::sendInterest(const Interest& interest, const EndpointId& endpointId)
 }
 
 inline void
-Face::sendData(const Data& data, const EndpointId& endpointId)
+Face::sendData(const Data& data, const EndpointId& endpointId, const EgressFields& fields)
 {
-  m_service->sendData(data, endpointId);
+  m_service->sendData(data, endpointId, fields);
 }
 
 inline void
@@ -24,6 +24,7 @@
  */
 
 #include "generic-link-service.hpp"
+#include "common/global.hpp"
 
 #include <ndn-cxx/lp/pit-token.hpp>
 #include <ndn-cxx/lp/tags.hpp>
@@ -39,6 +40,10 @@ constexpr size_t CONGESTION_MARK_SIZE = tlv::sizeOfVarNumber(lp::tlv::Congestion
                                         tlv::sizeOfVarNumber(sizeof(uint64_t)) +        // length
                                         tlv::sizeOfNonNegativeInteger(UINT64_MAX);      // value
 
+constexpr size_t PRIORITY_SIZE = tlv::sizeOfVarNumber(lp::tlv::Priority) + // type
+                                 tlv::sizeOfVarNumber(sizeof(uint64_t)) +  // length
+                                 tlv::sizeOfNonNegativeInteger(UINT64_MAX); // value
+
 GenericLinkService::GenericLinkService(const GenericLinkService::Options& options)
   : m_options(options)
   , m_fragmenter(m_options.fragmenterOptions, this)
@@ -103,11 +108,12 @@ GenericLinkService::doSendInterest(const Interest& interest, const EndpointId& e
 }
 
 void
-GenericLinkService::doSendData(const Data& data, const EndpointId& endpointId)
+GenericLinkService::doSendData(const Data& data, const EndpointId& endpointId,
+                               const EgressFields& fields)
 {
   lp::Packet lpPacket(data.wireEncode());
 
-  encodeLpFields(data, lpPacket);
+  encodeLpFields(data, lpPacket, fields);
 
   this->sendNetPacket(std::move(lpPacket), endpointId, false);
 }
@@ -124,7 +130,8 @@ GenericLinkService::doSendNack(const lp::Nack& nack, const EndpointId& endpointI
 }
 
 void
-GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket)
+GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket,
+                                   const EgressFields& fields)
 {
   if (m_options.allowLocalFields) {
     auto incomingFaceIdTag = netPkt.getTag<lp::IncomingFaceIdTag>();
@@ -162,18 +169,27 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
   else {
     lpPacket.add<lp::HopCountTagField>(0);
   }
-  
-  //Atif-Code: Geo Tag Field 
-  shared_ptr<lp::GeoTag> geoTag= netPkt.getTag<lp::GeoTag>();
-  if (geoTag != nullptr) {
-    lpPacket.add<lp::GeoTagField>(*geoTag);
+
+  // GeoTag is supplied by geo-aware strategies on egress; other traffic carries no position
+  if (fields.geoTag != nullptr) {
+    lpPacket.add<lp::GeoTagField>(*fields.geoTag);
   }
   else {
-    std::tuple<double,double,double> pos={0.0,0.0,0.0};
-    lp::GeoTag geoTag(pos);
-    lpPacket.add<lp::GeoTagField>(geoTag);
+    shared_ptr<lp::GeoTag> geoTag = netPkt.getTag<lp::GeoTag>();
+    if (geoTag != nullptr) {
+      lpPacket.add<lp::GeoTagField>(*geoTag);
+    }
+  }
+
+  if (fields.priority) {
+    lpPacket.add<lp::PriorityField>(*fields.priority);
+  }
+  else {
+    shared_ptr<lp::PriorityTag> priorityTag = netPkt.getTag<lp::PriorityTag>();
+    if (priorityTag != nullptr) {
+      lpPacket.add<lp::PriorityField>(*priorityTag);
+    }
   }
-    //Atif-Code: Geo Tag Field end 
 }
 
 void
@@ -191,6 +207,15 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId
     mtu -= CONGESTION_MARK_SIZE;
   }
 
+  // every fragment carries the Priority, so that the transport can schedule all of them alike
+  optional<uint64_t> priority;
+  if (pkt.has<lp::PriorityField>()) {
+    priority = pkt.get<lp::PriorityField>();
+    if (mtu != MTU_UNLIMITED) {
+      mtu -= PRIORITY_SIZE;
+    }
+  }
+
   BOOST_ASSERT(mtu == MTU_UNLIMITED || mtu > 0);
 
   if (m_options.allowFragmentation && mtu != MTU_UNLIMITED) {
@@ -222,17 +247,103 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId
   if (frags.size() > 1) {
     // Assign sequences to all fragments
     this->assignSequences(frags);
+
+    if (priority) {
+      std::for_each(frags.begin() + 1, frags.end(),
+                    [=] (lp::Packet& frag) { frag.add<lp::PriorityField>(*priority); });
+    }
   }
 
   if (m_options.reliabilityOptions.isEnabled && frags.front().has<lp::FragmentField>()) {
     m_reliability.handleOutgoing(frags, std::move(pkt), isInterest);
   }
 
+  if (m_options.allowAggregation && !m_options.reliabilityOptions.isEnabled &&
+      frags.size() == 1 && mtu != MTU_UNLIMITED) {
+    this->aggregatePacket(std::move(frags.front()), endpointId, static_cast<size_t>(mtu));
+    return;
+  }
+
   for (lp::Packet& frag : frags) {
     this->sendLpPacket(std::move(frag), endpointId);
   }
 }
 
+void
+GenericLinkService::aggregatePacket(lp::Packet&& pkt, const EndpointId& endpointId, size_t mtu)
+{
+  // LpPacket and Fragment headers of the aggregate
+  size_t headerSize = 2 * (tlv::sizeOfVarNumber(lp::tlv::LpPacket) + tlv::sizeOfVarNumber(mtu)) +
+                      PRIORITY_SIZE;
+  size_t pktSize = pkt.wireEncode().size();
+  if (pktSize + headerSize > mtu) {
+    this->flushAggregate(endpointId);
+    this->sendLpPacket(std::move(pkt), endpointId);
+    return;
+  }
+
+  auto it = m_aggregates.find(endpointId);
+  if (it != m_aggregates.end() && it->second.size + pktSize + headerSize > mtu) {
+    this->flushAggregate(endpointId);
+    it = m_aggregates.end();
+  }
+  if (it == m_aggregates.end()) {
+    it = m_aggregates.emplace(endpointId, Aggregate()).first;
+    it->second.flushTimer = getScheduler().schedule(m_options.aggregationHoldTime,
+                                                    [=] { this->flushAggregate(endpointId); });
+  }
+
+  optional<uint64_t> priority;
+  if (pkt.has<lp::PriorityField>()) {
+    priority = pkt.get<lp::PriorityField>();
+    if (!it->second.priority || *priority < *it->second.priority) {
+      it->second.priority = priority;
+    }
+  }
+  it->second.packets.push_back(std::move(pkt));
+  it->second.size += pktSize;
+
+  // the most urgent packets are not held back
+  if (priority && *priority == 0) {
+    this->flushAggregate(endpointId);
+  }
+}
+
+void
+GenericLinkService::flushAggregate(const EndpointId& endpointId)
+{
+  auto it = m_aggregates.find(endpointId);
+  if (it == m_aggregates.end()) {
+    return;
+  }
+  std::vector<lp::Packet> packets = std::move(it->second.packets);
+  size_t size = it->second.size;
+  optional<uint64_t> priority = it->second.priority;
+  m_aggregates.erase(it);
+
+  if (packets.size() == 1) {
+    this->sendLpPacket(std::move(packets.front()), endpointId);
+    return;
+  }
+
+  ndn::Buffer buffer;
+  buffer.reserve(size);
+  for (const lp::Packet& pkt : packets) {
+    Block wire = pkt.wireEncode();
+    buffer.insert(buffer.end(), wire.begin(), wire.end());
+    ++this->nOutAggregatedPackets;
+  }
+  ++this->nOutAggregates;
+
+  lp::Packet aggregate;
+  aggregate.add<lp::FragmentField>({buffer.cbegin(), buffer.cend()});
+  if (priority) {
+    aggregate.add<lp::PriorityField>(*priority);
+  }
+  NFD_LOG_FACE_TRACE("sending aggregate of " << packets.size() << " packets");
+  this->sendLpPacket(std::move(aggregate), endpointId);
+}
+
 void
 GenericLinkService::assignSequence(lp::Packet& pkt)
 {
@@ -296,33 +407,86 @@ GenericLinkService::doReceivePacket(const Block& packet, const EndpointId& endpo
   try {
     lp::Packet pkt(packet);
 
-    if (m_options.reliabilityOptions.isEnabled) {
-      m_reliability.processIncomingPacket(pkt);
+    if (isAggregate(pkt)) {
+      this->receiveAggregate(pkt, endpoint);
     }
-
-    if (!pkt.has<lp::FragmentField>()) {
-      NFD_LOG_FACE_TRACE("received IDLE packet: DROP");
-      return;
+    else {
+      this->receiveLpPacket(pkt, endpoint);
     }
+  }
+  catch (const tlv::Error& e) {
+    ++this->nInLpInvalid;
+    NFD_LOG_FACE_WARN("packet parse error (" << e.what() << "): DROP");
+  }
+}
 
-    if ((pkt.has<lp::FragIndexField>() || pkt.has<lp::FragCountField>()) &&
-        !m_options.allowReassembly) {
-      NFD_LOG_FACE_WARN("received fragment, but reassembly disabled: DROP");
-      return;
+void
+GenericLinkService::receiveLpPacket(const lp::Packet& pkt, const EndpointId& endpoint)
+{
+  if (m_options.reliabilityOptions.isEnabled) {
+    m_reliability.processIncomingPacket(pkt);
+  }
+
+  if (!pkt.has<lp::FragmentField>()) {
+    NFD_LOG_FACE_TRACE("received IDLE packet: DROP");
+    return;
+  }
+
+  if ((pkt.has<lp::FragIndexField>() || pkt.has<lp::FragCountField>()) &&
+      !m_options.allowReassembly) {
+    NFD_LOG_FACE_WARN("received fragment, but reassembly disabled: DROP");
+    return;
+  }
+
+  bool isReassembled = false;
+  Block netPkt;
+  lp::Packet firstPkt;
+  std::tie(isReassembled, netPkt, firstPkt) = m_reassembler.receiveFragment(endpoint, pkt);
+  if (isReassembled) {
+    this->decodeNetPacket(netPkt, firstPkt, endpoint);
+  }
+}
+
+void
+GenericLinkService::receiveAggregate(const lp::Packet& pkt, const EndpointId& endpoint)
+{
+  ++this->nInAggregates;
+
+  // the contained LpPackets share the buffer of the aggregate
+  Block wire = pkt.wireEncode();
+  ndn::Buffer::const_iterator begin, end;
+  std::tie(begin, end) = pkt.get<lp::FragmentField>();
+  size_t offset = std::distance(wire.getBuffer()->cbegin(), begin);
+  size_t endOffset = std::distance(wire.getBuffer()->cbegin(), end);
+
+  while (offset < endOffset) {
+    bool isOk = false;
+    Block element;
+    std::tie(isOk, element) = Block::fromBuffer(wire.getBuffer(), offset);
+    if (!isOk || offset + element.size() > endOffset) {
+      NDN_THROW(tlv::Error("Truncated LpPacket in aggregate"));
     }
+    offset += element.size();
 
-    bool isReassembled = false;
-    Block netPkt;
-    lp::Packet firstPkt;
-    std::tie(isReassembled, netPkt, firstPkt) = m_reassembler.receiveFragment(endpoint, pkt);
-    if (isReassembled) {
-      this->decodeNetPacket(netPkt, firstPkt, endpoint);
+    lp::Packet inner(element);
+    if (isAggregate(inner)) {
+      NDN_THROW(tlv::Error("Nested aggregate"));
     }
+    this->receiveLpPacket(inner, endpoint);
   }
-  catch (const tlv::Error& e) {
-    ++this->nInLpInvalid;
-    NFD_LOG_FACE_WARN("packet parse error (" << e.what() << "): DROP");
+}
+
+bool
+GenericLinkService::isAggregate(const lp::Packet& pkt)
+{
+  if (!pkt.has<lp::FragmentField>() || pkt.has<lp::FragIndexField>() ||
+      pkt.has<lp::FragCountField>()) {
+    return false;
   }
+
+  ndn::Buffer::const_iterator begin, end;
+  std::tie(begin, end) = pkt.get<lp::FragmentField>();
+  return begin != end && *begin == lp::tlv::LpPacket;
 }
 
 void
@@ -426,8 +590,21 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
 {
   BOOST_ASSERT(netPkt.type() == tlv::Data);
 
+  // Name is the first element of Data; decoding only the name lets forwarding drop unwanted
+  // broadcast receptions before MetaInfo, Content and Signature are decoded
+  netPkt.parse();
+  if (netPkt.elements().empty() || netPkt.elements().front().type() != tlv::Name) {
+    NDN_THROW(tlv::Error("Name element is missing or out of order"));
+  }
+  ndn::TagHost filterTags;
+  if (!this->wantData(Name(netPkt.elements().front()), endpointId, filterTags)) {
+    NFD_LOG_FACE_TRACE("received unwanted Data: DROP");
+    return;
+  }
+
   // forwarding expects Data to be created with make_shared
   auto data = make_shared<Data>(netPkt);
+  static_cast<ndn::TagHost&>(*data) = std::move(filterTags);
 
   if (firstPkt.has<lp::HopCountTagField>()) {
     data->setTag(make_shared<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
@@ -86,6 +86,21 @@ public:
   /** \brief count of outgoing LpPackets that were marked with congestion marks
    */
   PacketCounter nCongestionMarked;
+
+  /** \brief count of outgoing LpPackets that aggregate several network-layer packets
+   */
+  PacketCounter nOutAggregates;
+
+  /** \brief count of network-layer packets sent in aggregated LpPackets
+   *
+   *  The aggregation ratio is nOutAggregatedPackets / nOutAggregates; every aggregate saves
+   *  one link-layer frame per packet beyond the first.
+   */
+  PacketCounter nOutAggregatedPackets;
+
+  /** \brief count of incoming LpPackets that aggregate several network-layer packets
+   */
+  PacketCounter nInAggregates;
 };
 
 /** \brief GenericLinkService is a LinkService that implements the NDNLPv2 protocol
@@ -129,6 +144,20 @@ public:
      */
     LpReliability::Options reliabilityOptions;
 
+    /** \brief enables aggregation of outgoing packets
+     *
+     *  Unfragmented packets sent to the same endpoint within aggregationHoldTime are packed into
+     *  one LpPacket of up to MTU octets, whose Fragment is the sequence of their LpPackets.
+     *  Aggregation is not used together with reliability. Aggregated LpPackets are accepted on
+     *  receipt regardless of this option. The aggregate carries the most urgent Priority of its
+     *  packets, and a packet of priority 0 is sent right away along with the packets held so far.
+     */
+    bool allowAggregation = false;
+
+    /** \brief how long the first packet of an aggregate waits for more packets
+     */
+    time::nanoseconds aggregationHoldTime = 1_ms;
+
     /** \brief enables send queue congestion detection and marking
      */
     bool allowCongestionMarking = false;
@@ -199,7 +228,8 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE: // send path
   /** \brief send Data
    */
   void
-  doSendData(const Data& data, const EndpointId& endpointId) OVERRIDE_WITH_TESTS_ELSE_FINAL;
+  doSendData(const Data& data, const EndpointId& endpointId,
+             const EgressFields& fields) OVERRIDE_WITH_TESTS_ELSE_FINAL;
 
   /** \brief send Nack
    */
@@ -210,9 +240,11 @@ private: // send path
   /** \brief encode link protocol fields from tags onto an outgoing LpPacket
    *  \param netPkt network-layer packet to extract tags from
    *  \param lpPacket LpPacket to add link protocol fields to
+   *  \param fields fields of this transmission, which take precedence over the tags
    */
   void
-  encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket);
+  encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket,
+                 const EgressFields& fields = {});
 
   /** \brief send a complete network layer packet
    *  \param pkt LpPacket containing a complete network layer packet
@@ -222,6 +254,17 @@ private: // send path
   void
   sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId, bool isInterest);
 
+  /** \brief queue a complete LpPacket to be aggregated with other packets to \p endpointId
+   *  \param mtu maximum size of the aggregated LpPacket
+   */
+  void
+  aggregatePacket(lp::Packet&& pkt, const EndpointId& endpointId, size_t mtu);
+
+  /** \brief send the packets queued for aggregation to \p endpointId
+   */
+  void
+  flushAggregate(const EndpointId& endpointId);
+
   /** \brief assign a sequence number to an LpPacket
    */
   void
@@ -245,6 +288,26 @@ private: // receive path
   void
   doReceivePacket(const Block& packet, const EndpointId& endpoint) OVERRIDE_WITH_TESTS_ELSE_FINAL;
 
+  /** \brief process an LpPacket that carries a single network-layer packet or fragment
+   *  \throw tlv::Error parse error in an LpHeader field
+   */
+  void
+  receiveLpPacket(const lp::Packet& pkt, const EndpointId& endpoint);
+
+  /** \brief split an aggregated LpPacket and process each of the LpPackets it contains
+   *  \throw tlv::Error parse error in a contained LpPacket
+   */
+  void
+  receiveAggregate(const lp::Packet& pkt, const EndpointId& endpoint);
+
+  /** \return whether \p pkt is an aggregated LpPacket
+   *
+   *  The Fragment of an unfragmented LpPacket is an Interest or Data, so a Fragment that starts
+   *  with an LpPacket identifies an aggregate.
+   */
+  static bool
+  isAggregate(const lp::Packet& pkt);
+
   /** \brief decode incoming network-layer packet
    *  \param netPkt reassembled network-layer packet
    *  \param firstPkt LpPacket of first fragment
@@ -302,6 +365,17 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   LpReliability m_reliability;
   lp::Sequence m_lastSeqNo;
 
+  /** \brief packets waiting to be aggregated
+   */
+  struct Aggregate
+  {
+    std::vector<lp::Packet> packets;
+    size_t size = 0;
+    optional<uint64_t> priority;
+    scheduler::ScopedEventId flushTimer;
+  };
+  std::map<EndpointId, Aggregate> m_aggregates;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /// Time to mark next packet due to send queue congestion
   time::steady_clock::TimePoint m_nextMarkTime;
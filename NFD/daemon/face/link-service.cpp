@@ -65,14 +65,14 @@ LinkService::sendInterest(const Interest& interest, const EndpointId& endpoint)
 }
 
 void
-LinkService::sendData(const Data& data, const EndpointId& endpoint)
+LinkService::sendData(const Data& data, const EndpointId& endpoint, const EgressFields& fields)
 {
   BOOST_ASSERT(m_transport != nullptr);
   NFD_LOG_FACE_TRACE(__func__);
 
   ++this->nOutData;
 
-  doSendData(data, endpoint);
+  doSendData(data, endpoint, fields);
 
   afterSendData(data);
 }
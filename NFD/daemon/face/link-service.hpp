@@ -117,10 +117,11 @@ public: // upper interface to be used by forwarding
   sendInterest(const Interest& interest, const EndpointId& endpoint);
 
   /** \brief Send Data to \p endpoint
+   *  \param fields link-layer fields of this transmission only
    *  \pre setTransport has been called
    */
   void
-  sendData(const Data& data, const EndpointId& endpoint);
+  sendData(const Data& data, const EndpointId& endpoint, const EgressFields& fields = {});
 
   /** \brief Send Nack to \p endpoint
    *  \pre setTransport has been called
@@ -156,6 +157,23 @@ public: // upper interface to be used by forwarding
    */
   signal::Signal<LinkService, lp::Nack> afterSendNack;
 
+  /** \brief a predicate that decides, from the name alone, whether a received Data is wanted
+   *
+   *  It is invoked with the name and the sender of a Data packet, before the rest of the packet
+   *  is decoded. Returning false drops the packet. Tags the predicate sets on \p tags, such as
+   *  what it has decoded from the name, are set on the Data once it is decoded.
+   */
+  using DataFilter = std::function<bool(const Name& name, const EndpointId& endpoint,
+                                        const ndn::TagHost& tags)>;
+
+  /** \brief set the predicate applied to received Data, or unset it with nullptr
+   */
+  void
+  setDataFilter(DataFilter filter)
+  {
+    m_dataFilter = std::move(filter);
+  }
+
 public: // lower interface to be invoked by Transport
   /** \brief performs LinkService specific operations to receive a lower-layer packet
    */
@@ -188,6 +206,15 @@ protected:
   void
   notifyDroppedInterest(const Interest& packet);
 
+  /** \brief whether a received Data named \p name should be decoded and delivered to forwarding
+   *  \sa setDataFilter
+   */
+  bool
+  wantData(const Name& name, const EndpointId& endpoint, const ndn::TagHost& tags) const
+  {
+    return m_dataFilter == nullptr || m_dataFilter(name, endpoint, tags);
+  }
+
 private: // upper interface to be overridden in subclass (send path entrypoint)
   /** \brief performs LinkService specific operations to send an Interest to \p endpoint
    */
@@ -197,7 +224,7 @@ private: // upper interface to be overridden in subclass (send path entrypoint)
   /** \brief performs LinkService specific operations to send a Data to \p endpoint
    */
   virtual void
-  doSendData(const Data& data, const EndpointId& endpoint) = 0;
+  doSendData(const Data& data, const EndpointId& endpoint, const EgressFields& fields) = 0;
 
   /** \brief performs LinkService specific operations to send a Nack to \p endpoint
    */
@@ -211,6 +238,7 @@ private: // lower interface to be overridden in subclass
 private:
   Face* m_face;
   Transport* m_transport;
+  DataFilter m_dataFilter;
 };
 
 inline const Face*
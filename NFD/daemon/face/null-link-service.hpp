@@ -42,7 +42,7 @@ private:
   }
 
   void
-  doSendData(const Data&, const EndpointId&) final
+  doSendData(const Data&, const EndpointId&, const EgressFields&) final
   {
   }
 
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "denm-dcc.hpp"
+
+namespace nfd {
+namespace fw {
+
+std::ostream&
+operator<<(std::ostream& os, DccState state)
+{
+  switch (state) {
+    case DccState::RELAXED:
+      return os << "relaxed";
+    case DccState::ACTIVE:
+      return os << "active";
+    case DccState::RESTRICTIVE:
+      return os << "restrictive";
+  }
+  return os << static_cast<int>(state);
+}
+
+using GapTable = std::array<time::nanoseconds, DenmDcc::N_PRIORITIES>;
+using DropTable = std::array<double, DenmDcc::N_PRIORITIES>;
+
+// indexed by DccState, then by priority
+static const std::array<GapTable, 3> GAPS = {{
+  {{0_ms, 0_ms, 0_ms, 0_ms}},
+  {{5_ms, 20_ms, 50_ms, 100_ms}},
+  {{10_ms, 50_ms, 100_ms, 200_ms}},
+}};
+
+static const std::array<DropTable, 3> DROP_PROBABILITIES = {{
+  {{0.0, 0.0, 0.0, 0.0}},
+  {{0.0, 0.0, 0.25, 0.5}},
+  {{0.0, 0.25, 0.5, 0.75}},
+}};
+
+static size_t
+clampPriority(size_t priority)
+{
+  return std::min(priority, DenmDcc::N_PRIORITIES - 1);
+}
+
+DenmDcc::DenmDcc(const Options& options, ns3::Ptr<ns3::UniformRandomVariable> rng)
+  : m_options(options)
+  , m_rng(std::move(rng))
+{
+  m_nextTx.fill(time::steady_clock::TimePoint::min());
+}
+
+bool
+DenmDcc::sample(time::steady_clock::TimePoint now, const Load& load, ssize_t queueLength)
+{
+  if (!m_sampleTime) {
+    m_sampleTime = now;
+    m_load = load;
+    return false;
+  }
+
+  time::nanoseconds interval = now - *m_sampleTime;
+  if (interval < m_options.sampleInterval) {
+    return false;
+  }
+
+  uint64_t nFrames = load.nFrames - m_load.nFrames;
+  uint64_t nBytes = load.nBytes - m_load.nBytes;
+  double airtime = nBytes * 8.0 / m_options.dataRate +
+                   nFrames * time::duration_cast<time::duration<double>>(m_options.frameOverhead).count();
+  double cbr = std::min(airtime / time::duration_cast<time::duration<double>>(interval).count(), 1.0);
+
+  // ETSI TS 102 687 adaptive approach: the local sample is averaged with the previous one,
+  // then blended into the running estimate
+  m_cbr = 0.5 * m_cbr + 0.5 * (cbr + m_lastSample) / 2.0;
+  m_lastSample = cbr;
+  m_sampleTime = now;
+  m_load = load;
+
+  DccState state = DccState::RELAXED;
+  if (m_cbr >= m_options.restrictiveThreshold) {
+    state = DccState::RESTRICTIVE;
+  }
+  else if (m_cbr >= m_options.activeThreshold ||
+           (queueLength > 0 && static_cast<size_t>(queueLength) > m_options.queueThreshold)) {
+    state = DccState::ACTIVE;
+  }
+
+  if (state == m_state) {
+    return false;
+  }
+  m_state = state;
+  return true;
+}
+
+time::nanoseconds
+DenmDcc::getWait(size_t priority, time::steady_clock::TimePoint now) const
+{
+  auto nextTx = m_nextTx[clampPriority(priority)];
+  return nextTx > now ? nextTx - now : 0_ns;
+}
+
+bool
+DenmDcc::shouldDrop(size_t priority) const
+{
+  double p = getDropProbability(m_state, priority);
+  if (p <= 0.0) {
+    return false;
+  }
+  return m_rng->GetValue(0.0, 1.0) < p;
+}
+
+void
+DenmDcc::afterTransmit(size_t priority, time::steady_clock::TimePoint now)
+{
+  for (size_t i = clampPriority(priority); i < N_PRIORITIES; ++i) {
+    m_nextTx[i] = std::max(m_nextTx[i], now + getGap(m_state, i));
+  }
+}
+
+time::nanoseconds
+DenmDcc::getGap(DccState state, size_t priority)
+{
+  return GAPS.at(static_cast<size_t>(state))[clampPriority(priority)];
+}
+
+double
+DenmDcc::getDropProbability(DccState state, size_t priority)
+{
+  return DROP_PROBABILITIES.at(static_cast<size_t>(state))[clampPriority(priority)];
+}
+
+} // namespace fw
+} // namespace nfd
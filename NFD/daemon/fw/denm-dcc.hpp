@@ -0,0 +1,168 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_DENM_DCC_HPP
+#define NFD_DAEMON_FW_DENM_DCC_HPP
+
+#include "core/common.hpp"
+#include "table/denm-scope-table.hpp"
+
+#include <ns3/random-variable-stream.h>
+
+namespace nfd {
+namespace fw {
+
+/** \brief congestion state of a face, after the ETSI reactive DCC states
+ */
+enum class DccState : uint8_t {
+  RELAXED,    ///< the channel is lightly loaded, rebroadcasts are not throttled
+  ACTIVE,     ///< rebroadcasts of low priority DENMs are spaced out and thinned
+  RESTRICTIVE ///< the channel is congested, only the most urgent DENMs pass unthrottled
+};
+
+std::ostream&
+operator<<(std::ostream& os, DccState state);
+
+/** \brief decentralized congestion control of DENM rebroadcasts on one face
+ *
+ *  The channel busy ratio (CBR) is estimated from the frames sent and heard on the face:
+ *  every sampling interval, the airtime of those frames at the nominal data rate is divided
+ *  by the length of the interval and blended into a smoothed CBR, as in ETSI adaptive DCC.
+ *  A backlog in the send queue of the transport moves the face to at least DccState::ACTIVE,
+ *  since the channel cannot drain what this node offers.
+ *
+ *  Each state assigns every DENM priority a minimum gap between rebroadcasts and a drop
+ *  probability. The priority is the application type of the DENM, 0 being the most urgent.
+ *  Priority 0 is never dropped and its gap stays short in every state, so that the
+ *  rebroadcast latency of the most urgent events remains bounded under load. A rebroadcast
+ *  pushes back the next rebroadcast of its own and of every less urgent priority, but does
+ *  not delay more urgent ones.
+ */
+class DenmDcc
+{
+public:
+  static constexpr size_t N_PRIORITIES = DenmScopeTable::N_APP_TYPES;
+
+  struct Options
+  {
+    /** \brief nominal data rate of the channel, in bits per second
+     */
+    uint64_t dataRate = 6000000;
+
+    /** \brief airtime of a frame beyond its payload, such as the PHY preamble and MAC header
+     */
+    time::nanoseconds frameOverhead = 68_us;
+
+    /** \brief minimum time between two estimations of the CBR
+     */
+    time::nanoseconds sampleInterval = 100_ms;
+
+    /** \brief CBR at and above which the face is DccState::ACTIVE
+     */
+    double activeThreshold = 0.3;
+
+    /** \brief CBR at and above which the face is DccState::RESTRICTIVE
+     */
+    double restrictiveThreshold = 0.6;
+
+    /** \brief send queue length in bytes above which the face is at least DccState::ACTIVE
+     */
+    size_t queueThreshold = 8192;
+  };
+
+  /** \brief cumulative traffic seen on a face
+   */
+  struct Load
+  {
+    uint64_t nFrames = 0;
+    uint64_t nBytes = 0;
+  };
+
+  /** \param rng source of the drop decisions
+   */
+  DenmDcc(const Options& options, ns3::Ptr<ns3::UniformRandomVariable> rng);
+
+  /** \brief estimate the CBR, if the sampling interval has elapsed since the last estimation
+   *  \param load cumulative frames and bytes sent and heard on the face
+   *  \param queueLength send queue length in bytes, or a negative value if unknown
+   *  \return whether the state changed
+   */
+  bool
+  sample(time::steady_clock::TimePoint now, const Load& load, ssize_t queueLength);
+
+  /** \return how long a rebroadcast of \p priority must wait before it may be sent
+   */
+  time::nanoseconds
+  getWait(size_t priority, time::steady_clock::TimePoint now) const;
+
+  /** \brief draw whether a rebroadcast of \p priority is dropped in the current state
+   */
+  bool
+  shouldDrop(size_t priority) const;
+
+  /** \brief record that a rebroadcast of \p priority has been sent
+   */
+  void
+  afterTransmit(size_t priority, time::steady_clock::TimePoint now);
+
+  DccState
+  getState() const
+  {
+    return m_state;
+  }
+
+  /** \return smoothed channel busy ratio
+   */
+  double
+  getCbr() const
+  {
+    return m_cbr;
+  }
+
+  /** \return minimum gap between rebroadcasts of \p priority in \p state
+   */
+  static time::nanoseconds
+  getGap(DccState state, size_t priority);
+
+  /** \return drop probability of rebroadcasts of \p priority in \p state
+   */
+  static double
+  getDropProbability(DccState state, size_t priority);
+
+private:
+  const Options m_options;
+  ns3::Ptr<ns3::UniformRandomVariable> m_rng;
+  DccState m_state = DccState::RELAXED;
+  double m_cbr = 0.0;
+  double m_lastSample = 0.0;
+  optional<time::steady_clock::TimePoint> m_sampleTime;
+  Load m_load;
+  std::array<time::steady_clock::TimePoint, N_PRIORITIES> m_nextTx;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_DENM_DCC_HPP
@@ -0,0 +1,60 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "denm-decision.hpp"
+
+namespace nfd {
+namespace fw {
+
+std::ostream&
+operator<<(std::ostream& os, DenmDecision d)
+{
+  switch (d) {
+    case DenmDecision::PRODUCED:
+      return os << "produced";
+    case DenmDecision::CONSUMED:
+      return os << "consumed";
+    case DenmDecision::SCHEDULED:
+      return os << "scheduled";
+    case DenmDecision::SUPPRESSED:
+      return os << "suppressed";
+    case DenmDecision::CANCELLED:
+      return os << "cancelled";
+    case DenmDecision::REBROADCAST:
+      return os << "rebroadcast";
+    case DenmDecision::DUPLICATE:
+      return os << "duplicate";
+    case DenmDecision::OUT_OF_SCOPE:
+      return os << "out-of-scope";
+    case DenmDecision::DEFERRED:
+      return os << "deferred";
+    case DenmDecision::THROTTLED:
+      return os << "throttled";
+  }
+  return os << static_cast<int>(d);
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,57 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_DENM_DECISION_HPP
+#define NFD_DAEMON_FW_DENM_DECISION_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief what a node did with a DENM
+ *
+ *  Decisions are reported through Forwarder::afterDenmDecision and recorded in DENM traces.
+ */
+enum class DenmDecision : uint8_t {
+  PRODUCED,     ///< a local application produced the DENM
+  CONSUMED,     ///< a local application consumed the DENM
+  SCHEDULED,    ///< first reception within scope, a rebroadcast is scheduled
+  SUPPRESSED,   ///< first reception within scope, the suppression scheme decided not to rebroadcast
+  CANCELLED,    ///< an overheard copy cancelled the scheduled rebroadcast
+  REBROADCAST,  ///< the DENM was rebroadcast
+  DUPLICATE,    ///< a copy was received that did not change the decision
+  OUT_OF_SCOPE, ///< the DENM was received outside of its scope
+  DEFERRED,     ///< congestion control postponed the rebroadcast
+  THROTTLED     ///< congestion control dropped the rebroadcast
+};
+
+std::ostream&
+operator<<(std::ostream& os, DenmDecision d);
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_DENM_DECISION_HPP
@@ -0,0 +1,495 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "denm-geo-strategy.hpp"
+#include "../../../model/ndn-net-device-transport.hpp"
+#include "../../../model/ndn-position-cache.hpp"
+#include "../../../utils/tracers/ndn-denm-trace.hpp"
+#include "algorithm.hpp"
+#include "denm-name.hpp"
+#include "common/logger.hpp"
+
+#include <ndn-cxx/lp/geo-tag.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+namespace nfd {
+namespace fw {
+
+NFD_REGISTER_STRATEGY(DenmGeoStrategy);
+
+NFD_LOG_INIT(DenmGeoStrategy);
+
+const double DenmGeoStrategy::MAX_BEARING = 100.0;
+
+using ns3::ndn::DenmTrace;
+
+DenmGeoStrategy::DenmGeoStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , m_rng(ns3::CreateObject<ns3::UniformRandomVariable>())
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  DenmSuppression::Options options;
+  std::string scheme = processParams(parsed.parameters, options, m_dccOptions, m_isDccEnabled);
+
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    NDN_THROW(std::invalid_argument(
+      "DenmGeoStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+
+  m_suppression = DenmSuppression::create(scheme, options, m_rng);
+  NFD_LOG_DEBUG("suppression=" << scheme << " max-delay=" << options.maxDelay
+                << " radio-range=" << options.radioRange << " dcc=" << m_isDccEnabled);
+
+  m_removeFaceConn = beforeRemoveFace.connect([this] (const Face& face) {
+    m_dcc.erase(face.getId());
+  });
+}
+
+const Name&
+DenmGeoStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/denm-geo/%FD%01");
+  return strategyName;
+}
+
+int64_t
+DenmGeoStrategy::assignStreams(int64_t stream)
+{
+  m_rng->SetStream(stream);
+  return 1;
+}
+
+static uint64_t
+getParamValue(const std::string& param, const std::string& value)
+{
+  try {
+    if (!value.empty() && value[0] == '-')
+      NDN_THROW(boost::bad_lexical_cast());
+
+    return boost::lexical_cast<uint64_t>(value);
+  }
+  catch (const boost::bad_lexical_cast&) {
+    NDN_THROW(std::invalid_argument("Value of " + param + " must be a non-negative integer"));
+  }
+}
+
+std::string
+DenmGeoStrategy::processParams(const PartialName& params, DenmSuppression::Options& options,
+                               DenmDcc::Options& dccOptions, bool& isDccEnabled)
+{
+  std::string scheme = "contention";
+
+  for (const auto& component : params) {
+    std::string parsedStr(reinterpret_cast<const char*>(component.value()), component.value_size());
+    auto n = parsedStr.find("~");
+    if (n == std::string::npos) {
+      NDN_THROW(std::invalid_argument("Format is <parameter>~<value>"));
+    }
+
+    auto f = parsedStr.substr(0, n);
+    auto s = parsedStr.substr(n + 1);
+    if (f == "suppression") {
+      scheme = s;
+    }
+    else if (f == "max-delay") {
+      options.maxDelay = time::milliseconds(getParamValue(f, s));
+    }
+    else if (f == "radio-range") {
+      options.radioRange = getParamValue(f, s);
+    }
+    else if (f == "counter") {
+      options.counterThreshold = getParamValue(f, s);
+    }
+    else if (f == "distance") {
+      options.distanceThreshold = getParamValue(f, s);
+    }
+    else if (f == "area") {
+      options.areaThreshold = getParamValue(f, s) / 100.0;
+    }
+    else if (f == "dcc") {
+      isDccEnabled = getParamValue(f, s) != 0;
+    }
+    else if (f == "data-rate") {
+      dccOptions.dataRate = getParamValue(f, s) * 1000;
+      if (dccOptions.dataRate == 0) {
+        NDN_THROW(std::invalid_argument("Value of " + f + " must be positive"));
+      }
+    }
+    else if (f == "cbr-active") {
+      dccOptions.activeThreshold = getParamValue(f, s) / 100.0;
+    }
+    else if (f == "cbr-restrictive") {
+      dccOptions.restrictiveThreshold = getParamValue(f, s) / 100.0;
+    }
+    else {
+      NDN_THROW(std::invalid_argument("Parameter should be suppression, max-delay, radio-range, "
+                                      "counter, distance, area, dcc, data-rate, cbr-active, "
+                                      "or cbr-restrictive"));
+    }
+  }
+
+  return scheme;
+}
+
+void
+DenmGeoStrategy::afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
+                                      const shared_ptr<pit::Entry>& pitEntry)
+{
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+
+  int nEligibleNextHops = 0;
+  for (const auto& nexthop : fibEntry.getNextHops()) {
+    Face& outFace = nexthop.getFace();
+    if ((outFace.getId() == ingress.face.getId() && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) ||
+        wouldViolateScope(ingress.face, interest, outFace)) {
+      continue;
+    }
+    this->sendInterest(pitEntry, FaceEndpoint(outFace, 0), interest);
+    ++nEligibleNextHops;
+  }
+
+  if (nEligibleNextHops == 0) {
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " noNextHop");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(pitEntry, ingress, nackHeader);
+    this->rejectPendingInterest(pitEntry);
+  }
+}
+
+void
+DenmGeoStrategy::afterReceiveUnsolicitedData(const FaceEndpoint& ingress, const Data& data)
+{
+  auto denmTag = getDenmName(data);
+  if (denmTag == nullptr) {
+    NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName()
+                  << " not-denm");
+    return;
+  }
+  const DenmName& denm = denmTag->get();
+
+  DenmReception rx;
+  rx.event = ns3::Vector(denm.eventX, denm.eventY, 0.0);
+  rx.self = this->getSelfPosition();
+
+  // a DENM received from a face was admitted by wantUnsolicitedData, which tagged it with the
+  // decoded name and the key; only locally produced DENMs are decoded and hashed here
+  auto keyTag = data.getTag<PendingRebroadcastKeyTag>();
+  auto key = keyTag != nullptr ? keyTag->get() : PendingRebroadcastTable::computeKey(data.getName());
+  const DenmScopeTable::Scope* scope = this->getDenmScopeTable().find(denm.appType, denm.contentType,
+                                                                      denm.eventX, denm.eventY);
+  if (scope == nullptr || !isInScope(denm, *scope, rx.self)) {
+    NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName()
+                  << " out-of-scope");
+    this->recordDecision(DenmDecision::OUT_OF_SCOPE, key, data.getName(), denm, rx.self);
+    return;
+  }
+
+  // a locally produced DENM has no previous hop
+  bool isLocal = ingress.face.getScope() == ndn::nfd::FACE_SCOPE_LOCAL;
+  auto geoTag = data.getTag<lp::GeoTag>();
+  if (isLocal || geoTag == nullptr) {
+    rx.sender = rx.self;
+  }
+  else {
+    rx.sender = ns3::Vector(geoTag->getX(), geoTag->getY(), 0.0);
+    // the position belongs to the previous hop and must not leave this node with the Data
+    data.removeTag<lp::GeoTag>();
+  }
+
+  PendingRebroadcastTable::Entry* entry = this->getPendingRebroadcastTable().find(key);
+  if (entry == nullptr && this->getDeadDenmList().has(key)) {
+    NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName()
+                  << " duplicate");
+    this->recordDecision(DenmDecision::DUPLICATE, key, data.getName(), denm, rx.self);
+    return;
+  }
+  if (entry != nullptr) {
+    auto info = entry->getStrategyInfo<DenmSuppressionInfo>();
+    if (info == nullptr || !entry->isPending()) {
+      NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName()
+                    << " duplicate");
+      this->recordDecision(DenmDecision::DUPLICATE, key, data.getName(), denm, rx.self);
+      return;
+    }
+
+    info->addReception(rx);
+    size_t nReceived = info->getNReceived();
+    // a cancelled entry is settled and erased, so info must not be used afterwards
+    if (m_suppression->shouldCancel(rx, *info) && this->cancelRebroadcast(key)) {
+      NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName()
+                    << " duplicate copies=" << nReceived << " suppressed");
+      this->recordDecision(DenmDecision::CANCELLED, key, data.getName(), denm, rx.self);
+    }
+    else {
+      this->recordDecision(DenmDecision::DUPLICATE, key, data.getName(), denm, rx.self);
+    }
+    return;
+  }
+
+  // deliver to local applications without contention
+  for (Face& face : this->getFaceTable()) {
+    if (face.getId() > face::FACEID_RESERVED_MAX && face.getId() != ingress.face.getId() &&
+        face.getScope() == ndn::nfd::FACE_SCOPE_LOCAL) {
+      this->sendUnsolicitedData(data, FaceEndpoint(face, 0));
+    }
+  }
+
+  auto expiry = time::steady_clock::TimePoint(denm.referenceTime + scope->temporalRange);
+  DenmSuppressionInfo firstInfo;
+  firstInfo.addReception(rx);
+
+  optional<time::nanoseconds> delay;
+  if (isLocal) {
+    // the originator does not contend with anyone
+    delay = 0_ns;
+  }
+  else {
+    delay = m_suppression->afterFirstReception(rx, firstInfo);
+  }
+
+  if (delay) {
+    NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName()
+                  << " rebroadcast-in=" << *delay);
+    auto& newEntry = this->scheduleRebroadcast(key, data.shared_from_this(), *delay, expiry);
+    newEntry.insertStrategyInfo<DenmSuppressionInfo>(std::move(firstInfo));
+    this->recordDecision(DenmDecision::SCHEDULED, key, data.getName(), denm, rx.self, *delay);
+  }
+  else {
+    NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName()
+                  << " suppressed");
+    this->suppressRebroadcast(key);
+    this->recordDecision(DenmDecision::SUPPRESSED, key, data.getName(), denm, rx.self);
+  }
+}
+
+bool
+DenmGeoStrategy::wantUnsolicitedData(const FaceEndpoint& ingress, const Name& dataName,
+                                     const ndn::TagHost& tags)
+{
+  DenmName denm;
+  if (!DenmName::decode(dataName, denm)) {
+    return true;
+  }
+
+  // most receptions in dense traffic are out of scope or copies of a DENM that is no longer
+  // pending; they are dropped here, before the Data is decoded
+  ns3::Vector self = this->getSelfPosition();
+  auto key = PendingRebroadcastTable::computeKey(dataName);
+  const DenmScopeTable::Scope* scope = this->getDenmScopeTable().find(denm.appType, denm.contentType,
+                                                                      denm.eventX, denm.eventY);
+  if (scope == nullptr || !isInScope(denm, *scope, self)) {
+    NFD_LOG_DEBUG("wantUnsolicitedData in=" << ingress << " data=" << dataName << " out-of-scope");
+    this->recordDecision(DenmDecision::OUT_OF_SCOPE, key, dataName, denm, self);
+    return false;
+  }
+
+  PendingRebroadcastTable::Entry* entry = this->getPendingRebroadcastTable().find(key);
+  bool isDuplicate = entry == nullptr ? this->getDeadDenmList().has(key) :
+                     (!entry->isPending() || entry->getStrategyInfo<DenmSuppressionInfo>() == nullptr);
+  if (isDuplicate) {
+    NFD_LOG_DEBUG("wantUnsolicitedData in=" << ingress << " data=" << dataName << " duplicate");
+    this->recordDecision(DenmDecision::DUPLICATE, key, dataName, denm, self);
+    return false;
+  }
+
+  tags.setTag(make_shared<DenmNameTag>(denm));
+  tags.setTag(make_shared<PendingRebroadcastKeyTag>(key));
+  return true;
+}
+
+void
+DenmGeoStrategy::afterRebroadcastTimer(PendingRebroadcastTable::Key key, const Data& data)
+{
+  auto denmTag = getDenmName(data);
+  if (denmTag == nullptr) {
+    return;
+  }
+  const DenmName& denm = denmTag->get();
+  ns3::Vector self = this->getSelfPosition();
+  auto now = time::steady_clock::now();
+
+  auto inFaceIdTag = data.getTag<lp::IncomingFaceIdTag>();
+  std::vector<Face*> egressFaces;
+  time::nanoseconds wait = 0_ns;
+  for (Face& face : this->getFaceTable()) {
+    if (face.getId() <= face::FACEID_RESERVED_MAX || face.getScope() == ndn::nfd::FACE_SCOPE_LOCAL) {
+      continue;
+    }
+    // a broadcast medium needs the copy on the face it came from
+    if (inFaceIdTag != nullptr && face.getId() == *inFaceIdTag &&
+        face.getLinkType() == ndn::nfd::LINK_TYPE_POINT_TO_POINT) {
+      continue;
+    }
+    egressFaces.push_back(&face);
+    if (m_isDccEnabled) {
+      wait = std::max(wait, this->sampleDcc(face, now).getWait(denm.appType, now));
+    }
+  }
+
+  if (wait > 0_ns) {
+    PendingRebroadcastTable::Entry* entry = this->getPendingRebroadcastTable().find(key);
+    if (entry == nullptr || now + wait >= entry->getExpiry()) {
+      NFD_LOG_DEBUG("afterRebroadcastTimer data=" << data.getName() << " throttled wait=" << wait);
+      this->recordDecision(DenmDecision::THROTTLED, key, data.getName(), denm, self);
+      return;
+    }
+
+    // rescheduling replaces the record; the copies overheard so far are carried over, so that
+    // further copies can still cancel the deferred rebroadcast
+    auto info = entry->getStrategyInfo<DenmSuppressionInfo>();
+    DenmSuppressionInfo carriedInfo;
+    if (info != nullptr) {
+      carriedInfo = *info;
+    }
+    NFD_LOG_DEBUG("afterRebroadcastTimer data=" << data.getName() << " deferred=" << wait);
+    PendingRebroadcastTable::Entry& newEntry =
+      this->scheduleRebroadcast(key, data.shared_from_this(), wait, entry->getExpiry());
+    newEntry.insertStrategyInfo<DenmSuppressionInfo>(std::move(carriedInfo));
+    this->recordDecision(DenmDecision::DEFERRED, key, data.getName(), denm, self, wait);
+    return;
+  }
+
+  // the Data is shared with the timer and, if cached, the ContentStore, and is sent unchanged on
+  // every egress face. The position of this node and the priority, with which the egress queue of
+  // the face sends urgent DENMs ahead of other traffic, belong to this transmission only; the
+  // encoded GeoTag is shared by all transmissions of this node from the same position.
+  EgressFields fields;
+  fields.geoTag = this->getSelfGeoTag();
+  fields.priority = denm.appType;
+
+  bool isSent = egressFaces.empty();
+  for (Face* face : egressFaces) {
+    if (m_isDccEnabled) {
+      DenmDcc& dcc = m_dcc.at(face->getId());
+      if (dcc.shouldDrop(denm.appType)) {
+        NFD_LOG_DEBUG("afterRebroadcastTimer data=" << data.getName() << " to=" << face->getId()
+                      << " throttled state=" << dcc.getState());
+        continue;
+      }
+      dcc.afterTransmit(denm.appType, now);
+    }
+    NFD_LOG_DEBUG("afterRebroadcastTimer data=" << data.getName() << " to=" << face->getId());
+    this->sendUnsolicitedData(data, FaceEndpoint(*face, 0), fields);
+    isSent = true;
+  }
+
+  this->recordDecision(isSent ? DenmDecision::REBROADCAST : DenmDecision::THROTTLED,
+                       key, data.getName(), denm, self);
+}
+
+void
+DenmGeoStrategy::recordDecision(DenmDecision decision, PendingRebroadcastTable::Key key,
+                                const Name& dataName, const DenmName& denm, const ns3::Vector& self,
+                                time::nanoseconds delay)
+{
+  this->reportDenmDecision(dataName, decision, delay);
+
+  if (!DenmTrace::IsEnabled(decision)) {
+    return;
+  }
+  ns3::Ptr<ns3::Node> node = this->getNode();
+  double distance = ns3::CalculateDistance(ns3::Vector(denm.eventX, denm.eventY, 0.0),
+                                           ns3::Vector(self.x, self.y, 0.0));
+  DenmTrace::Record(node == nullptr ? std::numeric_limits<uint32_t>::max() : node->GetId(),
+                    decision, key, distance,
+                    decision == DenmDecision::SCHEDULED || decision == DenmDecision::DEFERRED ?
+                    delay : time::nanoseconds(-1));
+}
+
+bool
+DenmGeoStrategy::isInScope(const DenmName& denm, const DenmScopeTable::Scope& scope,
+                           const ns3::Vector& self)
+{
+  auto now = time::duration_cast<time::milliseconds>(time::steady_clock::now().time_since_epoch());
+  if (now - denm.referenceTime >= scope.temporalRange) {
+    return false;
+  }
+
+  ns3::Vector event(denm.eventX, denm.eventY, 0.0);
+  if (ns3::CalculateDistance(event, ns3::Vector(self.x, self.y, 0.0)) >= scope.spatialRange) {
+    return false;
+  }
+
+  double bearing = std::atan2(self.y - event.y, self.x - event.x) * 180.0 / M_PI;
+  return std::abs(bearing) < MAX_BEARING;
+}
+
+const DenmDcc*
+DenmGeoStrategy::getDcc(FaceId faceId) const
+{
+  auto it = m_dcc.find(faceId);
+  return it == m_dcc.end() ? nullptr : &it->second;
+}
+
+DenmDcc&
+DenmGeoStrategy::sampleDcc(const Face& face, time::steady_clock::TimePoint now)
+{
+  DenmDcc& dcc = m_dcc.emplace(std::piecewise_construct, std::forward_as_tuple(face.getId()),
+                               std::forward_as_tuple(m_dccOptions, m_rng)).first->second;
+
+  const face::FaceCounters& counters = face.getCounters();
+  DenmDcc::Load load;
+  load.nFrames = counters.nInPackets + counters.nOutPackets;
+  load.nBytes = counters.nInBytes + counters.nOutBytes;
+  auto transport = dynamic_cast<const ns3::ndn::NetDeviceTransport*>(face.getTransport());
+  if (transport != nullptr) {
+    load.nFrames += transport->getNOverheardFrames();
+    load.nBytes += transport->getNOverheardBytes();
+  }
+
+  if (dcc.sample(now, load, face.getTransport()->getSendQueueLength())) {
+    NFD_LOG_DEBUG("dcc face=" << face.getId() << " state=" << dcc.getState()
+                  << " cbr=" << dcc.getCbr());
+    this->reportDccState(face, dcc.getState(), dcc.getCbr());
+  }
+  return dcc;
+}
+
+ns3::Vector
+DenmGeoStrategy::getSelfPosition() const
+{
+  const ns3::ndn::PositionCache* positionCache = this->getPositionCache();
+  if (positionCache == nullptr) {
+    return ns3::Vector();
+  }
+  return positionCache->getPosition();
+}
+
+shared_ptr<const lp::GeoTag>
+DenmGeoStrategy::getSelfGeoTag() const
+{
+  const ns3::ndn::PositionCache* positionCache = this->getPositionCache();
+  if (positionCache == nullptr) {
+    static const auto origin = make_shared<const lp::GeoTag>(0.0, 0.0);
+    return origin;
+  }
+  return positionCache->getGeoTag();
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_DENM_GEO_STRATEGY_HPP
+#define NFD_DAEMON_FW_DENM_GEO_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "denm-dcc.hpp"
+#include "denm-suppression.hpp"
+
+namespace nfd {
+namespace fw {
+
+struct DenmName;
+
+/** \brief a strategy that geo-broadcasts unsolicited DENM Data
+ *
+ *  A DENM pushed into the namespace of this strategy is accepted if the receiving node lies
+ *  within the temporal and spatial scope configured for its application and content type in
+ *  the DenmScopeTable. An accepted DENM is delivered to local applications right away and
+ *  rebroadcast on non-local faces after a delay chosen by a pluggable suppression scheme,
+ *  unless overheard copies make the rebroadcast redundant. When the rebroadcast timer fires,
+ *  the DenmDcc of each egress face may defer the rebroadcast or drop it, according to the load
+ *  of the channel and the priority of the DENM. Rebroadcasts carry the application type of the
+ *  DENM as their LP Priority, so that urgent DENMs overtake other traffic queued on the face.
+ *  Out-of-scope receptions and copies of a DENM whose rebroadcast is no longer pending are
+ *  dropped from the name alone, before the face decodes the rest of the Data. Random delays
+ *  and drops are drawn from an ns-3 random variable, whose stream is fixed with assignStreams.
+ *
+ *  The strategy accepts the following parameters, in the form <parameter>~<value>:
+ *  - suppression: one of contention (default), counter, distance, area
+ *  - max-delay: upper bound of the rebroadcast delay in milliseconds
+ *  - radio-range: nominal radio range in meters
+ *  - counter: copies that cancel a rebroadcast in the counter-based scheme
+ *  - distance: sender distance in meters that cancels a rebroadcast in the distance-based scheme
+ *  - area: additional coverage in percent below which the area-based scheme cancels a rebroadcast
+ *  - dcc: 1 (default) to enable congestion control of rebroadcasts, 0 to disable it
+ *  - data-rate: nominal data rate of the channel in kbit/s, from which the CBR is estimated
+ *  - cbr-active: channel busy ratio in percent at which congestion control becomes active
+ *  - cbr-restrictive: channel busy ratio in percent at which congestion control becomes
+ *    restrictive
+ *
+ *  Interests under the namespace are forwarded to all FIB nexthops.
+ */
+class DenmGeoStrategy : public Strategy
+{
+public:
+  explicit
+  DenmGeoStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveUnsolicitedData(const FaceEndpoint& ingress, const Data& data) override;
+
+  bool
+  wantUnsolicitedData(const FaceEndpoint& ingress, const Name& dataName,
+                      const ndn::TagHost& tags) override;
+
+  void
+  afterRebroadcastTimer(PendingRebroadcastTable::Key key, const Data& data) override;
+
+  /** \brief fix the stream of the random variable behind suppression delays and DCC drops
+   */
+  int64_t
+  assignStreams(int64_t stream) override;
+
+  const DenmSuppression&
+  getSuppression() const
+  {
+    return *m_suppression;
+  }
+
+  /** \return congestion control state of \p faceId, or nullptr if the face has not sent
+   *          any rebroadcast or congestion control is disabled
+   */
+  const DenmDcc*
+  getDcc(FaceId faceId) const;
+
+  /** \brief check whether a node at \p self is within the scope of \p denm
+   */
+  static bool
+  isInScope(const DenmName& denm, const DenmScopeTable::Scope& scope, const ns3::Vector& self);
+
+private:
+  ns3::Vector
+  getSelfPosition() const;
+
+  shared_ptr<const lp::GeoTag>
+  getSelfGeoTag() const;
+
+  /** \brief report \p decision to forwarder observers and record it in the DenmTrace
+   */
+  void
+  recordDecision(DenmDecision decision, PendingRebroadcastTable::Key key, const Name& dataName,
+                 const DenmName& denm, const ns3::Vector& self,
+                 time::nanoseconds delay = time::nanoseconds::zero());
+
+  /** \brief update the congestion control state of \p face from its traffic counters
+   */
+  DenmDcc&
+  sampleDcc(const Face& face, time::steady_clock::TimePoint now);
+
+  static std::string
+  processParams(const PartialName& params, DenmSuppression::Options& options,
+                DenmDcc::Options& dccOptions, bool& isDccEnabled);
+
+private:
+  ns3::Ptr<ns3::UniformRandomVariable> m_rng;
+  unique_ptr<DenmSuppression> m_suppression;
+  DenmDcc::Options m_dccOptions;
+  bool m_isDccEnabled = true;
+  std::unordered_map<FaceId, DenmDcc> m_dcc;
+  signal::ScopedConnection m_removeFaceConn;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief only nodes whose bearing from the event is below this angle accept the DENM
+   */
+  static const double MAX_BEARING;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_DENM_GEO_STRATEGY_HPP
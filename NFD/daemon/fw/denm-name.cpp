@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "denm-name.hpp"
+#include "table/denm-scope-table.hpp"
+
+#include <ndn-cxx/encoding/tlv.hpp>
+
+namespace nfd {
+namespace fw {
+
+static const size_t DENM_NAME_SIZE = 7;
+static const size_t POSITION_SIZE = 8;
+static const double POSITION_SCALE = 1000.0; // millimeters
+
+static void
+writeFixedPoint(uint8_t* buf, double value)
+{
+  auto v = static_cast<uint32_t>(static_cast<int32_t>(std::lround(value * POSITION_SCALE)));
+  buf[0] = static_cast<uint8_t>(v >> 24);
+  buf[1] = static_cast<uint8_t>(v >> 16);
+  buf[2] = static_cast<uint8_t>(v >> 8);
+  buf[3] = static_cast<uint8_t>(v);
+}
+
+static double
+readFixedPoint(const uint8_t* buf)
+{
+  uint32_t v = (static_cast<uint32_t>(buf[0]) << 24) | (static_cast<uint32_t>(buf[1]) << 16) |
+               (static_cast<uint32_t>(buf[2]) << 8) | static_cast<uint32_t>(buf[3]);
+  return static_cast<int32_t>(v) / POSITION_SCALE;
+}
+
+const name::Component&
+DenmName::getKeyword()
+{
+  static const name::Component keyword("denm");
+  return keyword;
+}
+
+const name::Component&
+DenmName::getTerminationKeyword()
+{
+  static const name::Component keyword("termination");
+  return keyword;
+}
+
+Name
+DenmName::toName() const
+{
+  uint8_t position[POSITION_SIZE];
+  writeFixedPoint(position, eventX);
+  writeFixedPoint(position + 4, eventY);
+
+  auto eventMicros = time::duration_cast<time::microseconds>(eventTime);
+  auto referenceMicros = time::duration_cast<time::microseconds>(referenceTime);
+
+  Name name;
+  name.append(getKeyword())
+      .appendNumber(appType)
+      .appendNumber(contentType)
+      .append(position, sizeof(position))
+      .append(name::Component::fromNumber(static_cast<uint64_t>(eventMicros.count()),
+                                          tlv::TimestampNameComponent))
+      .append(name::Component::fromNumber(static_cast<uint64_t>(referenceMicros.count()),
+                                          tlv::TimestampNameComponent))
+      .append(name::Component::fromNumber(sequence, tlv::SequenceNumNameComponent));
+  if (isTermination) {
+    name.append(getTerminationKeyword());
+  }
+  return name;
+}
+
+bool
+DenmName::decode(const Name& name, DenmName& denm)
+{
+  if (name.size() < DENM_NAME_SIZE || name[0] != getKeyword()) {
+    return false;
+  }
+
+  const name::Component& appType = name[1];
+  const name::Component& contentType = name[2];
+  const name::Component& position = name[3];
+  const name::Component& eventTime = name[4];
+  const name::Component& referenceTime = name[5];
+  const name::Component& sequence = name[6];
+
+  if (!appType.isNumber() || !contentType.isNumber() ||
+      position.type() != tlv::GenericNameComponent || position.value_size() != POSITION_SIZE ||
+      eventTime.type() != tlv::TimestampNameComponent || !eventTime.isNumber() ||
+      referenceTime.type() != tlv::TimestampNameComponent || !referenceTime.isNumber() ||
+      referenceTime.toNumber() < eventTime.toNumber() ||
+      sequence.type() != tlv::SequenceNumNameComponent || !sequence.isNumber()) {
+    return false;
+  }
+  // a type outside the DenmScopeTable has no scope; narrowing it could alias a valid type
+  if (appType.toNumber() >= DenmScopeTable::N_APP_TYPES ||
+      contentType.toNumber() >= DenmScopeTable::N_CONTENT_TYPES) {
+    return false;
+  }
+
+  denm.appType = static_cast<uint32_t>(appType.toNumber());
+  denm.contentType = static_cast<uint32_t>(contentType.toNumber());
+  denm.eventX = readFixedPoint(position.value());
+  denm.eventY = readFixedPoint(position.value() + 4);
+  denm.eventTime = time::duration_cast<time::milliseconds>(
+                     time::microseconds(static_cast<int64_t>(eventTime.toNumber())));
+  denm.referenceTime = time::duration_cast<time::milliseconds>(
+                         time::microseconds(static_cast<int64_t>(referenceTime.toNumber())));
+  denm.sequence = sequence.toNumber();
+  denm.isTermination = name.size() > DENM_NAME_SIZE && name[DENM_NAME_SIZE] == getTerminationKeyword();
+  return true;
+}
+
+shared_ptr<DenmNameTag>
+getDenmName(const Data& data)
+{
+  auto tag = data.getTag<DenmNameTag>();
+  if (tag != nullptr) {
+    return tag;
+  }
+
+  DenmName denm;
+  if (!DenmName::decode(data.getName(), denm)) {
+    return nullptr;
+  }
+
+  tag = make_shared<DenmNameTag>(denm);
+  data.setTag(tag);
+  return tag;
+}
+
+} // namespace fw
+} // namespace nfd
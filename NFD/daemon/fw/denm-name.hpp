@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_DENM_NAME_HPP
+#define NFD_DAEMON_FW_DENM_NAME_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/tag.hpp>
+
+namespace nfd {
+namespace fw {
+
+/** \brief typed fields of a DENM Data name
+ *
+ *  A DENM name has the following structure:
+ *  \code
+ *  /denm/<appType>/<contentType>/<position>/<eventTime>/<referenceTime>/<sequence>
+ *  \endcode
+ *  where appType and contentType are GenericNameComponent nonNegativeIntegers, position is
+ *  a GenericNameComponent holding the event x and y coordinates as two big-endian 32-bit
+ *  signed fixed-point numbers in millimeters, eventTime and referenceTime are
+ *  TimestampNameComponents in microseconds, and sequence is a SequenceNumNameComponent.
+ *  A DENM that terminates its event carries one more component, getTerminationKeyword(),
+ *  after the sequence.
+ *
+ *  eventTime is when the event was detected, and is shared by all DENMs of the event.
+ *  referenceTime is when this DENM was generated, so that repetitions and the termination
+ *  of a long-lived event are still within the temporal range of their scope.
+ *
+ *  DenmName is a plain struct, so that it can be cached on the packet with DenmNameTag and
+ *  read by every pipeline stage without decoding the name again.
+ */
+struct DenmName
+{
+  uint32_t appType = 0;
+  uint32_t contentType = 0;
+  double eventX = 0.0;
+  double eventY = 0.0;
+  time::milliseconds eventTime = 0_ms;
+  time::milliseconds referenceTime = 0_ms;
+  uint64_t sequence = 0;
+  bool isTermination = false;
+
+  /** \brief encode the fields into a Name
+   */
+  Name
+  toName() const;
+
+  /** \brief decode \p name
+   *  \param[out] denm the decoded fields, unchanged if decoding fails
+   *  \retval true \p name is a well-formed DENM name
+   *  \retval false \p name is not a DENM name, its app type or content type is outside the
+   *                range of DenmScopeTable, or its referenceTime precedes its eventTime
+   *
+   *  The fields are read directly from the TLV blocks of the name components,
+   *  without converting the name to its URI representation.
+   */
+  static bool
+  decode(const Name& name, DenmName& denm);
+
+  /** \return the first name component of every DENM name
+   */
+  static const name::Component&
+  getKeyword();
+
+  /** \return the name component that marks a DENM terminating its event
+   */
+  static const name::Component&
+  getTerminationKeyword();
+};
+
+/** \brief a packet tag that caches the decoded DenmName of a Data
+ */
+using DenmNameTag = ndn::SimpleTag<DenmName, 0x60000100>;
+
+/** \brief get the DENM fields of \p data, decoding its name on first use
+ *  \return the fields cached in DenmNameTag, or nullptr if \p data is not a DENM
+ */
+shared_ptr<DenmNameTag>
+getDenmName(const Data& data);
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_DENM_NAME_HPP
@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "denm-suppression.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief number of lattice steps across the radius of the area-based scheme's sampling disc
+ */
+static const int AREA_SAMPLE_STEPS = 8;
+
+unique_ptr<DenmSuppression>
+DenmSuppression::create(const std::string& scheme, const Options& options,
+                        ns3::Ptr<ns3::UniformRandomVariable> rng)
+{
+  if (scheme == "contention") {
+    return make_unique<DenmContentionSuppression>(options, rng);
+  }
+  if (scheme == "counter") {
+    return make_unique<DenmCounterSuppression>(options, rng);
+  }
+  if (scheme == "distance") {
+    return make_unique<DenmDistanceSuppression>(options, rng);
+  }
+  if (scheme == "area") {
+    return make_unique<DenmAreaSuppression>(options, rng);
+  }
+  NDN_THROW(std::invalid_argument("Unknown DENM suppression scheme " + scheme));
+}
+
+DenmSuppression::DenmSuppression(const Options& options, ns3::Ptr<ns3::UniformRandomVariable> rng)
+  : m_options(options)
+  , m_rng(std::move(rng))
+{
+}
+
+time::nanoseconds
+DenmSuppression::getRandomDelay() const
+{
+  double maxDelay = time::nanoseconds(m_options.maxDelay).count();
+  return time::nanoseconds(static_cast<time::nanoseconds::rep>(m_rng->GetValue(0.0, maxDelay)));
+}
+
+optional<time::nanoseconds>
+DenmContentionSuppression::afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo&)
+{
+  double progress = (ns3::CalculateDistance(rx.self, rx.event) -
+                     ns3::CalculateDistance(rx.sender, rx.event)) / m_options.radioRange;
+  double ratio = std::max(0.0, 1.0 - progress);
+  auto contention = time::nanoseconds(static_cast<time::nanoseconds::rep>(
+                      ratio * time::nanoseconds(m_options.maxDelay).count()));
+  return contention + this->getRandomDelay();
+}
+
+bool
+DenmContentionSuppression::shouldCancel(const DenmReception&, const DenmSuppressionInfo&)
+{
+  return true;
+}
+
+optional<time::nanoseconds>
+DenmCounterSuppression::afterFirstReception(const DenmReception&, const DenmSuppressionInfo&)
+{
+  return this->getRandomDelay();
+}
+
+bool
+DenmCounterSuppression::shouldCancel(const DenmReception&, const DenmSuppressionInfo& info)
+{
+  return info.getNReceived() >= m_options.counterThreshold;
+}
+
+optional<time::nanoseconds>
+DenmDistanceSuppression::afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo& info)
+{
+  if (this->shouldCancel(rx, info)) {
+    return nullopt;
+  }
+  return this->getRandomDelay();
+}
+
+bool
+DenmDistanceSuppression::shouldCancel(const DenmReception& rx, const DenmSuppressionInfo&)
+{
+  // earlier senders have been checked when they were received
+  return ns3::CalculateDistance(rx.self, rx.sender) < m_options.distanceThreshold;
+}
+
+DenmAreaSuppression::DenmAreaSuppression(const Options& options,
+                                         ns3::Ptr<ns3::UniformRandomVariable> rng)
+  : DenmSuppression(options, std::move(rng))
+{
+  double step = m_options.radioRange / AREA_SAMPLE_STEPS;
+  for (int i = -AREA_SAMPLE_STEPS; i <= AREA_SAMPLE_STEPS; ++i) {
+    for (int j = -AREA_SAMPLE_STEPS; j <= AREA_SAMPLE_STEPS; ++j) {
+      if (i * i + j * j <= AREA_SAMPLE_STEPS * AREA_SAMPLE_STEPS) {
+        m_samples.emplace_back(i * step, j * step, 0.0);
+      }
+    }
+  }
+}
+
+double
+DenmAreaSuppression::computeAdditionalCoverage(const ns3::Vector& self,
+                                               const std::vector<ns3::Vector>& senders) const
+{
+  double rangeSquared = m_options.radioRange * m_options.radioRange;
+  size_t nUncovered = std::count_if(m_samples.begin(), m_samples.end(), [&] (const ns3::Vector& sample) {
+    double x = self.x + sample.x;
+    double y = self.y + sample.y;
+    return std::none_of(senders.begin(), senders.end(), [&] (const ns3::Vector& sender) {
+      return (x - sender.x) * (x - sender.x) + (y - sender.y) * (y - sender.y) <= rangeSquared;
+    });
+  });
+  return static_cast<double>(nUncovered) / m_samples.size();
+}
+
+optional<time::nanoseconds>
+DenmAreaSuppression::afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo& info)
+{
+  if (this->shouldCancel(rx, info)) {
+    return nullopt;
+  }
+  return this->getRandomDelay();
+}
+
+bool
+DenmAreaSuppression::shouldCancel(const DenmReception& rx, const DenmSuppressionInfo& info)
+{
+  return this->computeAdditionalCoverage(rx.self, info.senders) < m_options.areaThreshold;
+}
+
+} // namespace fw
+} // namespace nfd
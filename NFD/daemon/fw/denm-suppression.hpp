@@ -0,0 +1,242 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_DENM_SUPPRESSION_HPP
+#define NFD_DAEMON_FW_DENM_SUPPRESSION_HPP
+
+#include "strategy-info.hpp"
+
+#include <ns3/random-variable-stream.h>
+#include <ns3/vector.h>
+
+namespace nfd {
+namespace fw {
+
+/** \brief a copy of a DENM as seen by a suppression scheme
+ */
+struct DenmReception
+{
+  ns3::Vector event;  ///< location of the event
+  ns3::Vector sender; ///< location of the node the copy was received from
+  ns3::Vector self;   ///< location of this node
+};
+
+/** \brief per-DENM state of a suppression scheme
+ *
+ *  This is placed on the PendingRebroadcastTable record of the DENM.
+ */
+class DenmSuppressionInfo : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1050;
+  }
+
+  /** \brief remember a received copy
+   */
+  void
+  addReception(const DenmReception& rx)
+  {
+    senders.push_back(rx.sender);
+  }
+
+  /** \return number of copies received, including the first one
+   */
+  size_t
+  getNReceived() const
+  {
+    return senders.size();
+  }
+
+public:
+  /** \brief locations of the nodes the copies were received from, in order of reception
+   */
+  std::vector<ns3::Vector> senders;
+};
+
+/** \brief a decision algorithm on whether and when a DENM is rebroadcast
+ *
+ *  A scheme is consulted when a DENM is first received, to choose the delay after which it is
+ *  rebroadcast, and again for every further copy overheard while the rebroadcast is pending,
+ *  to decide whether the rebroadcast has become redundant.
+ */
+class DenmSuppression : noncopyable
+{
+public:
+  struct Options
+  {
+    /** \brief upper bound of the delay before a rebroadcast
+     */
+    time::milliseconds maxDelay = 2_ms;
+
+    /** \brief nominal radio range in meters
+     */
+    double radioRange = 200.0;
+
+    /** \brief number of copies after which the counter-based scheme cancels a rebroadcast
+     */
+    size_t counterThreshold = 3;
+
+    /** \brief sender distance in meters below which the distance-based scheme
+     *         cancels a rebroadcast
+     */
+    double distanceThreshold = 50.0;
+
+    /** \brief fraction of the radio range disc below which the area-based scheme
+     *         considers the additional coverage of a rebroadcast negligible
+     */
+    double areaThreshold = 0.187;
+  };
+
+  /** \brief create a scheme by name
+   *  \param scheme one of "contention", "counter", "distance", "area"
+   *  \param rng source of the random assessment delay
+   *  \throw std::invalid_argument unknown scheme
+   */
+  static unique_ptr<DenmSuppression>
+  create(const std::string& scheme, const Options& options,
+         ns3::Ptr<ns3::UniformRandomVariable> rng);
+
+  DenmSuppression(const Options& options, ns3::Ptr<ns3::UniformRandomVariable> rng);
+
+  virtual
+  ~DenmSuppression() = default;
+
+  /** \brief decide the rebroadcast delay of a DENM received for the first time
+   *  \param info state of the DENM, which already contains \p rx
+   *  \return delay before the rebroadcast, or nullopt if the DENM should not be rebroadcast
+   */
+  virtual optional<time::nanoseconds>
+  afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo& info) = 0;
+
+  /** \brief decide whether to cancel a pending rebroadcast after overhearing another copy
+   *  \param info state of the DENM, which already contains \p rx
+   */
+  virtual bool
+  shouldCancel(const DenmReception& rx, const DenmSuppressionInfo& info) = 0;
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+protected:
+  /** \return a random assessment delay, uniformly distributed in [0, maxDelay]
+   */
+  time::nanoseconds
+  getRandomDelay() const;
+
+protected:
+  const Options m_options;
+  ns3::Ptr<ns3::UniformRandomVariable> m_rng;
+};
+
+/** \brief contention timer scheme
+ *
+ *  The delay shrinks with the progress this node makes away from the event compared to the
+ *  sender, so that the farthest receiver rebroadcasts first. Any overheard copy cancels the
+ *  pending rebroadcast.
+ */
+class DenmContentionSuppression : public DenmSuppression
+{
+public:
+  using DenmSuppression::DenmSuppression;
+
+  optional<time::nanoseconds>
+  afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+
+  bool
+  shouldCancel(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+};
+
+/** \brief counter-based scheme
+ *
+ *  The rebroadcast is cancelled once counterThreshold copies have been received within
+ *  a random assessment delay.
+ */
+class DenmCounterSuppression : public DenmSuppression
+{
+public:
+  using DenmSuppression::DenmSuppression;
+
+  optional<time::nanoseconds>
+  afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+
+  bool
+  shouldCancel(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+};
+
+/** \brief distance-based scheme
+ *
+ *  The DENM is not rebroadcast if any sender is closer than distanceThreshold,
+ *  since the rebroadcast would reach few additional nodes.
+ */
+class DenmDistanceSuppression : public DenmSuppression
+{
+public:
+  using DenmSuppression::DenmSuppression;
+
+  optional<time::nanoseconds>
+  afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+
+  bool
+  shouldCancel(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+};
+
+/** \brief area-based scheme
+ *
+ *  The DENM is not rebroadcast if the part of this node's radio range disc that is not
+ *  covered by the discs of the senders falls below areaThreshold. Coverage is estimated on
+ *  a fixed lattice of sample points within the disc.
+ */
+class DenmAreaSuppression : public DenmSuppression
+{
+public:
+  DenmAreaSuppression(const Options& options, ns3::Ptr<ns3::UniformRandomVariable> rng);
+
+  optional<time::nanoseconds>
+  afterFirstReception(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+
+  bool
+  shouldCancel(const DenmReception& rx, const DenmSuppressionInfo& info) override;
+
+  /** \return fraction of the radio range disc around \p self not covered by any of \p senders
+   */
+  double
+  computeAdditionalCoverage(const ns3::Vector& self, const std::vector<ns3::Vector>& senders) const;
+
+private:
+  /** \brief sample points within the radio range disc, relative to its center
+   */
+  std::vector<ns3::Vector> m_samples;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_DENM_SUPPRESSION_HPP
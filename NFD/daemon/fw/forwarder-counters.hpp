@@ -30,6 +30,8 @@
 
 namespace nfd {
 
+class PendingRebroadcastTable;
+
 /** \brief counters provided by Forwarder
  */
 class ForwarderCounters
@@ -46,6 +48,10 @@ public:
 
   PacketCounter nCsHits;
   PacketCounter nCsMisses;
+
+  SizeCounter<PendingRebroadcastTable> nPendingRebroadcastEntries;
+  PacketCounter nRebroadcastsScheduled;
+  PacketCounter nRebroadcastsSuppressed;
 };
 
 } // namespace nfd
@@ -24,7 +24,6 @@
  */
 
 #include "forwarder.hpp"
-#include "../../../model/ndn-l3-protocol.hpp"
 #include "algorithm.hpp"
 #include "best-route-strategy2.hpp"
 #include "strategy.hpp"
@@ -33,11 +32,7 @@
 #include "table/cleanup.hpp"
 #include <ndn-cxx/lp/tags.hpp>
 #include "face/null-face.hpp"
-#include <ns3/node-list.h>
-#include <ns3/node.h>
-#include "ns3/mobility-model.h"
-#include "ns3/core-module.h"
-#include "ns3/random-variable-stream.h"
+
 namespace nfd {
 
 NFD_LOG_INIT(Forwarder);
@@ -68,6 +63,10 @@ Forwarder::Forwarder(FaceTable& faceTable)
       [this, &face] (const Data& data, const EndpointId& endpointId) {
         this->startProcessData(FaceEndpoint(face, endpointId), data);
       });
+    face.getLinkService()->setDataFilter(
+      [this, &face] (const Name& dataName, const EndpointId& endpointId, const ndn::TagHost& tags) {
+        return this->wantIncomingData(FaceEndpoint(face, endpointId), dataName, tags);
+      });
     face.afterReceiveNack.connect(
       [this, &face] (const lp::Nack& nack, const EndpointId& endpointId) {
         this->startProcessNack(FaceEndpoint(face, endpointId), nack);
@@ -87,6 +86,9 @@ Forwarder::Forwarder(FaceTable& faceTable)
   });
 
   m_strategyChoice.setDefaultStrategy(getDefaultStrategyName());
+
+  m_counters.nPendingRebroadcastEntries.observe(&m_pendingRebroadcasts);
+  m_deadDenmList.setWindow(m_denmScopeTable.getMaxTemporalRange());
 }
 
 Forwarder::~Forwarder() = default;
@@ -187,7 +189,7 @@ Forwarder::onContentStoreMiss(const FaceEndpoint& ingress,
   afterCsMiss(interest);
 
   // insert in-record
-  pitEntry->insertOrUpdateInRecord(ingress.face, interest);
+  pitEntry->insertOrUpdateInRecord(ingress.face, interest, ingress.endpoint);
 
   // set PIT expiry timer to the time that the last PIT in-record expires
   auto lastExpiring = std::max_element(pitEntry->in_begin(), pitEntry->in_end(),
@@ -288,47 +290,7 @@ Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
 void
 Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
 {
-  // std::cout<<"Data Name: "<<data.getName().toUri()<<std::endl;
-  std::string data_name=data.getName().toUri();
-  int node_id=GetCurrentNode()->GetId();
-  int timerValue=0;
-  ns3::Ptr<ns3::Node> currentNode = GetCurrentNode();
-  if (currentNode->GetId()!=0)
-  {
-    if (data.getName().toUri().find("denm") != std::string::npos) 
-    {
-
-      bool isValidForForwarding=TemporalSpatialValidation(data);
-
-      
-      if (isValidForForwarding)
-      {
-        // duplication check and event removal
-        
-
-        auto ev_association=GetEventNameAssociation(node_id,data_name);
-        if (ev_association.node_id==-1) // -1 node id represent that no record
-        {
-
-          timerValue=GetTimerValue(data);
-          n_packet_transmissions++;
-          std::cout<<"ndn.Forwarder Total Packet Processed  Node-Id: "<<GetCurrentNode()->GetId()<<" Transmissions: "<<n_packet_transmissions<<std::endl;
-        }
-        else
-        { // data is duplicated, remove association and relevant event 
-          std::cout<<"ndn.Forwarder onIncomingData Data is duplicated emove association and relevant event. Node-Id: "<<GetCurrentNode()->GetId()<<std::endl;
-          RemoveEventNameAssociation(ev_association.event_id,node_id,data_name);
-        }
-      }
-      else
-      {
-          return; //drop
-      }
-    }
-  }
-  // receive Data Atif-Code:  
-  //std::cout<<"ndn.Forwarder onIncomingData()  I have received the data on face type: "<<ingress.face.getLinkType()<<"on node node id: "<<GetCurrentNode()->GetId()<<std::endl;
-  
+  // receive Data
   NFD_LOG_DEBUG("onIncomingData in=" << ingress << " data=" << data.getName());
   data.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
   ++m_counters.nInData;
@@ -347,35 +309,6 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
   if (pitMatches.size() == 0) {
     // goto Data unsolicited pipeline
     this->onDataUnsolicited(ingress, data);
-
-    // Atif-Code Forwarding unsolicited Data on the ingress face (adhoc)
-
-    if (ns3::Simulator::GetContext() < 1000) // this check prevents 4535459 value of Context, I am not sure why it returns 4535459
-    {
-      ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext()); // Get Current node from simulator context
-      ns3::Ptr<ns3::ndn::L3Protocol> l3Object = node->GetObject<ns3::ndn::L3Protocol>(); // Getting l3 Object
-
-      //std::cout << "Node Id :" << node->GetId() << std::endl;
-
-      // iteratation over face table
-      for (auto & face : l3Object->getForwarder()->m_faceTable)
-      {
-
-        // std::cout << "Node Id: "<<GetCurrentNode()->GetId()<<" Face Id :" << face.getId() 
-        // <<"Face count: " <<l3Object->getForwarder()->m_faceTable.size()<< std::endl;
-        if(face.getId()!=258){
-         //this->onOutgoingData(data, FaceEndpoint(face,face.getId()));
-          ns3::Time time = ns3::MilliSeconds (timerValue);
-          ns3::EventId eventId = ns3::Simulator::Schedule (time, &Forwarder::onOutgoingData, this, data, FaceEndpoint(face,face.getId()));
-          
-         SetEventNameAssociation(eventId,node_id,data_name,timerValue);
-        }
-
-      }
-    }
-
-
-
     return;
   }
 
@@ -418,7 +351,7 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
       // remember pending downstreams
       for (const pit::InRecord& inRecord : pitEntry->getInRecords()) {
         if (inRecord.getExpiry() > now) {
-          pendingDownstreams.emplace(&inRecord.getFace(), 0);
+          pendingDownstreams.emplace(&inRecord.getFace(), inRecord.getEndpoint());
         }
       }
 
@@ -455,12 +388,28 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
   }
 }
 
+bool
+Forwarder::wantIncomingData(const FaceEndpoint& ingress, const Name& dataName,
+                            const ndn::TagHost& tags)
+{
+  if (m_strategyChoice.findEffectiveStrategy(dataName).wantUnsolicitedData(ingress, dataName, tags)) {
+    return true;
+  }
+
+  // the strategy only judges unsolicited Data; Data that may satisfy an Interest is always wanted
+  auto&& ntMatches = m_nameTree.findAllMatches(dataName,
+    [] (const name_tree::Entry& nte) { return nte.hasPitEntries(); });
+  if (ntMatches.begin() != ntMatches.end()) {
+    return true;
+  }
+
+  NFD_LOG_DEBUG("wantIncomingData in=" << ingress << " data=" << dataName << " unwanted");
+  return false;
+}
+
 void
 Forwarder::onDataUnsolicited(const FaceEndpoint& ingress, const Data& data)
 {
-  // Atif-Code 
- // std::cout<<"ndn.Forwarder onDataunsolicted() unsolicted data received named: "<<data.getName()<<" node-id: "<<GetCurrentNode()->GetId()<<std::endl;
-  
   // accept to cache?
   fw::UnsolicitedDataDecision decision = m_unsolicitedDataPolicy->decide(ingress.face, data);
   if (decision == fw::UnsolicitedDataDecision::CACHE) {
@@ -469,13 +418,14 @@ Forwarder::onDataUnsolicited(const FaceEndpoint& ingress, const Data& data)
   }
 
   NFD_LOG_DEBUG("onDataUnsolicited in=" << ingress << " data=" << data.getName() << " decision=" << decision);
+
+  // trigger strategy: after receive unsolicited Data
+  m_strategyChoice.findEffectiveStrategy(data.getName()).afterReceiveUnsolicitedData(ingress, data);
 }
 
 void
-Forwarder::onOutgoingData(const Data& data, const FaceEndpoint& egress)
+Forwarder::onOutgoingData(const Data& data, const FaceEndpoint& egress, const EgressFields& fields)
 {
-   // Atif-Code: 
-  //std::cout<<"ndn.Forwarder onOutgoingData()  I am validating for the forwarding of the Data: Link Type:"<<egress.face.getLinkType()<<std::endl;
   if (egress.face.getId() == face::INVALID_FACEID) {
     NFD_LOG_WARN("onOutgoingData out=(invalid) data=" << data.getName());
     return;
@@ -491,15 +441,35 @@ Forwarder::onOutgoingData(const Data& data, const FaceEndpoint& egress)
     return;
   }
 
-  // Atif-Code:
-  //std::cout<<"ndn.Forwarder onOutgoingData()  I am forwarding the Data"<<std::endl;
   // TODO traffic manager
 
   // send Data
-  egress.face.sendData(data, egress.endpoint);
+  egress.face.sendData(data, egress.endpoint, fields);
   ++m_counters.nOutData;
 }
 
+void
+Forwarder::onRebroadcastTimer(PendingRebroadcastTable::Key key, const Data& data)
+{
+  m_pendingRebroadcasts.markFired(key);
+
+  // trigger strategy: after rebroadcast timer
+  m_strategyChoice.findEffectiveStrategy(data.getName()).afterRebroadcastTimer(key, data);
+
+  // unless the strategy has scheduled the rebroadcast again, the DENM is settled
+  const PendingRebroadcastTable::Entry* entry = m_pendingRebroadcasts.find(key);
+  if (entry == nullptr || !entry->isPending()) {
+    this->settleRebroadcast(key);
+  }
+}
+
+void
+Forwarder::settleRebroadcast(PendingRebroadcastTable::Key key)
+{
+  m_pendingRebroadcasts.erase(key);
+  m_deadDenmList.add(key);
+}
+
 void
 Forwarder::onIncomingNack(const FaceEndpoint& ingress, const lp::Nack& nack)
 {
@@ -655,7 +625,7 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
   BOOST_ASSERT(duration >= 0_ms);
 
   pitEntry->expiryTimer.cancel();
-  pitEntry->expiryTimer = getScheduler().schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  pitEntry->expiryTimer = m_timerWheel.schedule(duration, [=] { onInterestFinalize(pitEntry); });
 }
 
 void
@@ -690,324 +660,4 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, Face* upstream)
   }
 }
 
-void 
-Forwarder::SetCurrentNodeLocationInDataPacket(const Data& data){
-  std::tuple<double,double,double> currenNodeLocation=CurrentNodeLocation();
-  lp::GeoTag geoTag(currenNodeLocation);
-  data.setTag<lp::GeoTag>(std::make_shared<lp::GeoTag>(geoTag));
-}
-
-int 
-Forwarder::GetTimerValue(Data data){
-
-  ns3::Ptr<ns3::UniformRandomVariable> m_rand(ns3::CreateObject<ns3::UniformRandomVariable>());
-  std::tuple<double, double, double> current_node_location=CurrentNodeLocation();
-  std::tuple<double, double, double>  event_location=GetEventLocationFromDataName(data);
-  std::tuple<double, double, double> previous_node_location=GetNodeLocationFromDataPacket(data);
-
-  double distance_previous_node=DistanceCalculate(std::get<0>(previous_node_location),std::get<1>(previous_node_location),std::get<0>(event_location),std::get<0>(event_location));
-  double distance_current_node=DistanceCalculate(std::get<0>(current_node_location),std::get<1>(current_node_location),std::get<0>(event_location),std::get<0>(event_location));
-  double delay_random=m_rand->GetValue(0, 2);
-  double forward_timer=delay_max*((1-(((distance_previous_node)-(distance_current_node))/rr_max)))+delay_random;
-  
-  std::cout<<"Forwarder::GetTimerValue: Timer Value:  "<<std::ceil(forward_timer)<<std::endl;
-  
-  return abs(std::ceil(forward_timer));
-}
-
-std::tuple<double, double, double> 
-Forwarder::GetEventLocationFromDataName(Data data){
-
-  std::vector<std::string> nameComponents= SplitString(data.getName().toUri(),'/');
-  std::string eventLocation= nameComponents[3];
-  std::vector<std::string> event_location=SplitString(eventLocation,'-');
-
-  std::tuple<double, double, double> location={std::stod(event_location[0]),std::stod(event_location[1]),0};
-  return location;
-}
-
-
-std::tuple<double, double, double> 
-Forwarder::GetNodeLocationFromDataPacket(Data data){
-  std::shared_ptr<lp::GeoTag> tag = data.getTag<lp::GeoTag>();
-  std::tuple<double, double, double> location;
-   if(tag != nullptr)
-   {
-    location=tag->getPos();
-   }
-   return location;
-}
-
-bool 
-Forwarder::TemporalSpatialValidation(Data data){
-
-  bool isValidationPassed=false;
-
-  std::vector<std::string> nameComponents=SplitString(data.getName().toUri(),'/');
-  std::string applicationType= nameComponents[1];
-  std::string contentTpe= nameComponents[2];
-  std::string eventLocation= nameComponents[3];
-  std::string eventTime= nameComponents[4];
-  
-  Forwarder::STValue stRange=getSingleSTValue(std::stoi(applicationType),std::stoi(contentTpe));
-  bool timeValidity=TimeValidity(std::stoi(eventTime),stRange.temporalRange);
-  bool spatialValidity=SpatialValidity(eventLocation,stRange.spatialRange);
-  bool angleValidity=AngleValidity(eventLocation,100);
-  if (timeValidity)
-  {
-    std::cout<<"Temporal Validity Passed"<<std::endl;
-    if (spatialValidity)
-    {
-       std::cout<<"Spatial Validity Passed"<<std::endl;
-      if (angleValidity)
-      {
-       std::cout<<"Angle Validity Passed"<<std::endl;
-       isValidationPassed=true;
-        
-      }
-      
-    }
-    
-  }
-  return isValidationPassed;
-}
-
-
-bool
-Forwarder::TimeValidity(int eventTime, int timeThresholdByApplicationType){
-  int currentTime=CurrentTime();
-  std::cout<<"Temporal DIfference: "<<(currentTime-eventTime)<<std::endl;
-  if ((currentTime-eventTime)<timeThresholdByApplicationType)
-  {
-    return true;
-  }
-  return false;
-}
-
-bool
-Forwarder::AngleValidity(std::string eventLocation,  int angleThresholdByApplicationType)
-{
-  std::vector<std::string> eventLocationCollection=SplitString(eventLocation,'-');
-  std::tuple<double,double,double> currentNodeLocation=CurrentNodeLocation();
-  double angle=abs(AngleCalculate(std::stod(eventLocationCollection[0]),std::stod(eventLocationCollection[1]),std::get<0>(currentNodeLocation),std::get<1>(currentNodeLocation)));
-  std::cout<<"Angle Value is: "<<angle<<std::endl;
-  if (angle<angleThresholdByApplicationType)
-  {
-    return true;
-  }
-  return false;
-}
-
-bool
-Forwarder::SpatialValidity(std::string eventLocation, int distanceThresholdByApplicationType){
-  
-  std::vector<std::string> eventLocationCollection=SplitString(eventLocation,'-');
-  std::tuple<double,double,double> currentNodeLocation=CurrentNodeLocation();
-  
-  // std::cout<<"nfd.SpatialValidity() Event Location X: "<<std::stod(eventLocationCollection[0])<<std::endl;
-  // std::cout<<"nfd.SpatialValidity() Event Location Y: "<<std::stod(eventLocationCollection[1])<<std::endl;
-  // std::cout<<"nfd.SpatialValidity() Node Location X: "<<std::get<0>(currentNodeLocation)<<std::endl;
-  // std::cout<<"nfd.SpatialValidity() Node Location Y: "<<std::get<1>(currentNodeLocation)<<std::endl;
-
-  double distance=DistanceCalculate(std::stod(eventLocationCollection[0]),std::stod(eventLocationCollection[1]),std::get<0>(currentNodeLocation),std::get<1>(currentNodeLocation));
-  
-  std::cout<<"Distance of current node from producer: "<<distance<<std::endl;
-
-  if (distance<distanceThresholdByApplicationType)
-  {
-    return true;
-  }
-  return false;
-}
-
-double 
-Forwarder::DistanceCalculate(double x1, double y1, double x2, double y2)
-{
-	double x = x1 - x2; //calculating number to square in next step
-	double y = y1 - y2;
-	double dist;
-
-	dist = pow(x, 2) + pow(y, 2);       //calculating Euclidean distance
-	dist = sqrt(dist);                  
-
-	return dist;
-}
-double 
-Forwarder::AngleCalculate(double x1, double y1, double x2, double y2)
-{
-	double angle=atan2((y2-y1),(x2-x1));            
-  angle=(angle*180)/3.14;
-	return angle;
-}
-int
-Forwarder::CurrentTime()
-{
-ndn::time::steady_clock::TimePoint now = ::ndn::time::steady_clock::now(); 
-ndn::time::milliseconds milliseconds = ::ndn::time::duration_cast<::ndn::time::milliseconds>(now.time_since_epoch());
-return milliseconds.count(); 
-}
-
-std::vector<std::string> 
-Forwarder::SplitString(std::string stringValue,  char c)
-{
-	std::string buff{""};
-	std::vector<std::string> stringCollection;
-	
-	for(auto n:stringValue)
-	{
-		if(n != c) 
-      buff+=n; 
-    else
-		  if(n == c && buff != "") 
-      { 
-        stringCollection.push_back(buff); 
-        buff = ""; 
-      }
-	}
-	if(buff != "") stringCollection.push_back(buff);
-	
-	return stringCollection;
-}
-
-
-void 
-Forwarder::PrintLocations(const Data& data){
-
-  ns3::Ptr<ns3::Node> currentNode= GetCurrentNode();
-  if (currentNode->GetId()==0)
-  {
-    //Atif-Code: Printing current location of the node
-    CurrentNodeLocation();
-
-     //Atif-Code: getting geo tag
-    std::shared_ptr<lp::GeoTag> tag = data.getTag<lp::GeoTag>();
-    if(tag == nullptr)
-    {
-        std::cout<<"My Custom Tag value is: null"<<std::endl;
-    }
-    else
-    {
-      std::tuple<double, double, double> location=tag->getPos();
-      std::cout<<"ndn.forwrder PrintLocations()  Geo tag x location: "<<std::get<0>(location)<<"node-id:  "<<GetCurrentNode()->GetId()<<std::endl;
-      std::cout<<"ndn.forwrder PrintLocations()  Geo tag y location: "<<std::get<1>(location)<<"node-id:  "<<GetCurrentNode()->GetId()<<std::endl;
-      std::cout<<"ndn.forwrder PrintLocations()  Geo tag z location: "<<std::get<2>(location)<<"node-id:  "<<GetCurrentNode()->GetId()<<std::endl;
-    }
-  }
-}
-
-ns3::Ptr<ns3::Node> 
-Forwarder::GetCurrentNode()
-{
-  ns3::Ptr<ns3::Node> currentNode;
-  if (ns3::Simulator::GetContext() < 100000) 
-  {
-        currentNode = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-  }
-  return currentNode;
-}
-
-std::tuple<double,double,double>
-Forwarder::CurrentNodeLocation()
-{
-    std::tuple<double,double,double> currentLocation;
-    if (ns3::Simulator::GetContext() < 1000000) {
-
-        ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-        uint32_t nodeId = node->GetId();
-        //std::cout<<"ndn.Forwarder getCurrentNodeLocation(): node-id:  "<<nodeId<<std::endl;
-        ns3::Ptr<ns3::MobilityModel> mobility = node->GetObject<ns3::MobilityModel>();
-        if (mobility!=nullptr)
-        {
-          // std::cout<<"ndn.Forwarder getCurrentNodeLocation(): x-postion:  "<<mobility->GetPosition().x<<std::endl;
-          // std::cout<<"ndn.Forwarder getCurrentNodeLocation(): y-postion:  "<<mobility->GetPosition().y<<std::endl;
-          // std::cout<<"ndn.Forwarder getCurrentNodeLocation(): z-postion:  "<<mobility->GetPosition().z<<std::endl;
-          currentLocation = {mobility->GetPosition().x,mobility->GetPosition().y,mobility->GetPosition().z};
-        }
-        else
-        {
-          std::cout<<"ndn.Forwarder getCurrentNodeLocation(): mobility return nullptr."<<std::endl;
-        }
-   }
-   return currentLocation;
-}
-
-Forwarder::STValue
-Forwarder::getSingleSTValue(int applicationType, int contentType)
-{
- std::vector<Forwarder::STValue> st_valueCollection = getSTValues();
- Forwarder::STValue stValueItem;
- for (std::vector<STValue>::iterator it = st_valueCollection.begin() ; it != st_valueCollection.end(); ++it){
-   if (it->appType==applicationType && it->contentType==contentType)
-   {
-     return *it;
-   } 
- }
-}
-
-std::vector<Forwarder::STValue>
-Forwarder::getSTValues()
-{
-  //static table to the nodes for scope comparsion 
-  std::vector<Forwarder::STValue> st_valueCollection; 
-
-  //st_valueCollection.push_back({appType,contentType, spatialRange, temporalRange});
-  st_valueCollection.push_back({0,0, 201, 20});
-  st_valueCollection.push_back({0,1, 201, 20});
-  st_valueCollection.push_back({0,2, 201, 20});
-  st_valueCollection.push_back({0,3, 201, 20});
-  
-  st_valueCollection.push_back({1,0, 201, 20});
-  st_valueCollection.push_back({1,1, 201, 20});
-  st_valueCollection.push_back({1,2, 201, 20});
-  st_valueCollection.push_back({1,3, 201, 20});
-
-  st_valueCollection.push_back({2,0, 201, 20});
-  st_valueCollection.push_back({2,1, 201, 20});
-  st_valueCollection.push_back({2,2, 201, 20});
-  st_valueCollection.push_back({2,3, 201, 20});
-
-  st_valueCollection.push_back({3,0, 201, 20});
-  st_valueCollection.push_back({3,1, 201, 20});
-  st_valueCollection.push_back({3,2, 201, 20});
-  st_valueCollection.push_back({3,3, 201, 20});
-
- 
-  // for (std::vector<Forwarder::STValue>::iterator it=st_valueCollection.begin(); it!=st_valueCollection.end();++it)
-  // {
-  //   // std::cout<<"ndn.Forwarder getSTValues(): printing static table values."<<std::endl;
-  //   // std::cout<<"ndn.Forwarder getSTValues(): printing static table values: appType:"<<it->appType<<std::endl;
-  //   // std::cout<<"ndn.Forwarder getSTValues(): printing static table values: contentType."<<it->contentType<<std::endl;
-  //   // std::cout<<"ndn.Forwarder getSTValues(): printing static table values: spatialRange."<<it->spatialRange<<std::endl;
-  //   // std::cout<<"ndn.Forwarder getSTValues(): printing static table values: temporalRange."<<it->temporalRange<<std::endl;
-  // }
-  return st_valueCollection;
-}
-
-Forwarder::EventNameAssociation
-Forwarder::GetEventNameAssociation( int node_id, std::string data_name)
-{ 
- ns3::EventId eventId;
- Forwarder::EventNameAssociation empty_en_assocication = {eventId,-1,"",-1};
- for (std::vector<EventNameAssociation>::iterator it = event_name_assoc_collection.begin() ; it != event_name_assoc_collection.end(); ++it)
- {
-   if (it->node_id==node_id && it->data_name==data_name)
-   {
-     empty_en_assocication={it->event_id,it->node_id,it->data_name,it->timer_value};
-     break;
-   } 
- }
-    return empty_en_assocication;
-}
-void
-Forwarder::SetEventNameAssociation(ns3::EventId  event_id, int node_id, std::string data_name,  int timer_value){
-  event_name_assoc_collection.push_back({event_id, node_id, data_name,timer_value});
-}
-void
-Forwarder::RemoveEventNameAssociation(ns3::EventId  event_id, int node_id, std::string data_name){
-
-  // Forwarder::EventNameAssociation removedValue=GetEventNameAssociation(node_id,data_name);
-  // event_name_assoc_collection.erase(std::remove(event_name_assoc_collection.begin(), event_name_assoc_collection.end(), removedValue), event_name_assoc_collection.end()); 
-  ns3::Simulator::Remove(event_id);
-}
-
 } // namespace nfd
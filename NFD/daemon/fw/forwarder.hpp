@@ -28,17 +28,29 @@
 
 #include "face-table.hpp"
 #include "forwarder-counters.hpp"
+#include "denm-dcc.hpp"
+#include "denm-decision.hpp"
 #include "unsolicited-data-policy.hpp"
+#include "common/timer-wheel.hpp"
 #include "face/face-endpoint.hpp"
 #include "table/fib.hpp"
 #include "table/pit.hpp"
 #include "table/cs.hpp"
 #include "table/measurements.hpp"
 #include "table/strategy-choice.hpp"
+#include "table/dead-denm-list.hpp"
 #include "table/dead-nonce-list.hpp"
+#include "table/denm-scope-table.hpp"
 #include "table/network-region-table.hpp"
+#include "table/pending-rebroadcast-table.hpp"
 #include <ns3/node.h>
 
+namespace ns3 {
+namespace ndn {
+class PositionCache;
+} // namespace ndn
+} // namespace ns3
+
 namespace nfd {
 
 namespace fw {
@@ -77,6 +89,25 @@ public:
     m_unsolicitedDataPolicy = std::move(policy);
   }
 
+  /** \brief set the node that owns this forwarder
+   *  \param positionCache position of \p node, must outlive the forwarder
+   *
+   *  This is invoked once by L3Protocol when the stack is installed, so that the pipelines
+   *  never need to look up the node from the simulator context.
+   */
+  void
+  setNode(ns3::Ptr<ns3::Node> node, const ns3::ndn::PositionCache& positionCache)
+  {
+    m_node = node;
+    m_positionCache = &positionCache;
+  }
+
+  ns3::Ptr<ns3::Node>
+  getNode() const
+  {
+    return m_node;
+  }
+
 public: // forwarding entrypoints and tables
   /** \brief start incoming Interest processing
    *  \param ingress face on which Interest is received and endpoint of the sender
@@ -166,6 +197,36 @@ public: // forwarding entrypoints and tables
     return m_networkRegionTable;
   }
 
+  DenmScopeTable&
+  getDenmScopeTable()
+  {
+    return m_denmScopeTable;
+  }
+
+  PendingRebroadcastTable&
+  getPendingRebroadcastTable()
+  {
+    return m_pendingRebroadcasts;
+  }
+
+  /** \note The window of the list follows the longest temporal range of the DenmScopeTable
+   *        when the table is configured through TablesConfigSection. Callers that modify the
+   *        DenmScopeTable directly should update the window with DeadDenmList::setWindow.
+   */
+  DeadDenmList&
+  getDeadDenmList()
+  {
+    return m_deadDenmList;
+  }
+
+  /** \brief timers of the forwarding pipelines, such as PIT expiry and DENM rebroadcasts
+   */
+  const TimerWheel&
+  getTimerWheel() const
+  {
+    return m_timerWheel;
+  }
+
 public:
   /** \brief trigger before PIT entry is satisfied
    *  \sa Strategy::beforeSatisfyInterest
@@ -185,6 +246,20 @@ public:
    */
   signal::Signal<Forwarder, Interest> afterCsMiss;
 
+  /** \brief Signals a DENM forwarding decision made by the effective strategy
+   *
+   *  The first argument is the Data name, so that decisions taken before the Data is decoded
+   *  can be reported. The last argument is the rebroadcast delay of DenmDecision::SCHEDULED
+   *  and the additional delay of DenmDecision::DEFERRED, and zero otherwise.
+   */
+  signal::Signal<Forwarder, Name, fw::DenmDecision, time::nanoseconds> afterDenmDecision;
+
+  /** \brief Signals that the DENM congestion control state of a face has changed
+   *
+   *  The last argument is the smoothed channel busy ratio that caused the change.
+   */
+  signal::Signal<Forwarder, Face, fw::DccState, double> afterDccStateChange;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   /** \brief incoming Interest pipeline
    */
@@ -219,6 +294,14 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   VIRTUAL_WITH_TESTS void
   onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry);
 
+  /** \brief early admission of an incoming Data, invoked by the face before the Data is decoded
+   *  \param tags tags to be set on the Data once it is decoded
+   *  \return false if the Data is unsolicited and unwanted by the effective strategy
+   *  \sa Strategy::wantUnsolicitedData
+   */
+  VIRTUAL_WITH_TESTS bool
+  wantIncomingData(const FaceEndpoint& ingress, const Name& dataName, const ndn::TagHost& tags);
+
   /** \brief incoming Data pipeline
    */
   VIRTUAL_WITH_TESTS void
@@ -230,9 +313,39 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   onDataUnsolicited(const FaceEndpoint& ingress, const Data& data);
 
   /** \brief outgoing Data pipeline
+   *  \param fields link-layer fields of this transmission only
    */
   VIRTUAL_WITH_TESTS void
-  onOutgoingData(const Data& data, const FaceEndpoint& egress);
+  onOutgoingData(const Data& data, const FaceEndpoint& egress, const EgressFields& fields = {});
+
+  /** \brief rebroadcast timer pipeline, invoked when a timer scheduled by a strategy fires
+   *  \sa Strategy::scheduleRebroadcast
+   */
+  VIRTUAL_WITH_TESTS void
+  onRebroadcastTimer(PendingRebroadcastTable::Key key, const Data& data);
+
+  /** \brief move the record of \p key from the PendingRebroadcastTable to the DeadDenmList
+   */
+  void
+  settleRebroadcast(PendingRebroadcastTable::Key key);
+
+  /** \brief emit afterDenmDecision on behalf of a strategy
+   *  \sa Strategy::reportDenmDecision
+   */
+  void
+  onDenmDecision(const Name& dataName, fw::DenmDecision decision, time::nanoseconds delay)
+  {
+    this->afterDenmDecision(dataName, decision, delay);
+  }
+
+  /** \brief emit afterDccStateChange on behalf of a strategy
+   *  \sa Strategy::reportDccState
+   */
+  void
+  onDccStateChange(const Face& face, fw::DccState state, double cbr)
+  {
+    this->afterDccStateChange(face, state, cbr);
+  }
 
   /** \brief incoming Nack pipeline
    */
@@ -253,6 +366,9 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
 
 PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   /** \brief set a new expiry timer (now + \p duration) on a PIT entry
+   *
+   *  The timer is scheduled on m_timerWheel; a satisfied entry kept for straggler Data is
+   *  erased by the same timer.
    */
   void
   setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::milliseconds duration);
@@ -278,94 +394,13 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
     trigger(m_strategyChoice.findEffectiveStrategy(pitEntry));
   }
 
-// Atif-Code: Spatial Temporal Values
-struct STValue
-{
-  int contentType;
-  int appType;
-  int spatialRange;
-  int temporalRange;
-};
-
-std::vector<STValue>
-getSTValues();
-
-// Atif-Code: Spatial Temporal Values End
-
 private:
-
-void 
-SetCurrentNodeLocationInDataPacket(const Data& data);
-
-void 
-PrintLocations(const Data& data);
-
-std::tuple<double,double,double>
-CurrentNodeLocation();
-
-ns3::Ptr<ns3::Node> 
-GetCurrentNode();
-
-bool 
-TemporalSpatialValidation(Data data);
-
-STValue
-getSingleSTValue(int appType, int contentType);
-
-std::vector<std::string> 
-SplitString(std::string stringValue,  char c);
-
-bool
-TimeValidity(int eventTime, int timeThresholdByApplicationType);
-
-bool
-SpatialValidity(std::string eventLocation, int distanceThresholdByApplicationType);
-
-bool
-AngleValidity(std::string eventLocation,  int angleThresholdByApplicationType);
-
-double 
-DistanceCalculate(double x1, double y1, double x2, double y2);
-
-double 
-AngleCalculate(double x1, double y1, double x2, double y2);
-
-int
-CurrentTime();
-
-int 
-GetTimerValue(Data data);
-
-std::tuple<double, double, double> 
-GetNodeLocationFromDataPacket(Data data);
-
-std::tuple<double, double, double> 
-GetEventLocationFromDataName(Data data);
-
-// Atif-Code: Spatial Temporal Values
-struct EventNameAssociation
-{
-  ns3::EventId  event_id;
-  int node_id;
-  std::string data_name;
-  int timer_value;
-};
-
-Forwarder::EventNameAssociation
-GetEventNameAssociation(int node_id, std::string data_name);
-void
-SetEventNameAssociation(ns3::EventId  event_id, int node_id, std::string data_name,  int timer_value);
-void
-RemoveEventNameAssociation(ns3::EventId  event_id, int node_id, std::string data_name);
-
-
-int n_packet_transmissions=0;
-
-ForwarderCounters m_counters;
-
+  ForwarderCounters m_counters;
 
   FaceTable& m_faceTable;
   unique_ptr<fw::UnsolicitedDataPolicy> m_unsolicitedDataPolicy;
+  // declared before the tables, so that timers referring to table entries are destroyed last
+  TimerWheel         m_timerWheel;
 
   NameTree           m_nameTree;
   Fib                m_fib;
@@ -375,12 +410,13 @@ ForwarderCounters m_counters;
   StrategyChoice     m_strategyChoice;
   DeadNonceList      m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
+  DenmScopeTable     m_denmScopeTable;
+  PendingRebroadcastTable m_pendingRebroadcasts;
+  DeadDenmList       m_deadDenmList;
   shared_ptr<Face>   m_csFace;
-  std::vector<EventNameAssociation> event_name_assoc_collection;
-
-  u_int32_t delay_max=2;
-  u_int32_t rr_max=200;
 
+  ns3::Ptr<ns3::Node> m_node;
+  const ns3::ndn::PositionCache* m_positionCache = nullptr;
 
   // allow Strategy (base class) to enter pipelines
   friend class fw::Strategy;
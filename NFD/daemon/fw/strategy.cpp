@@ -189,6 +189,18 @@ Strategy::afterReceiveData(const shared_ptr<pit::Entry>& pitEntry,
   this->sendDataToAll(pitEntry, ingress, data);
 }
 
+void
+Strategy::afterReceiveUnsolicitedData(const FaceEndpoint& ingress, const Data& data)
+{
+  NFD_LOG_DEBUG("afterReceiveUnsolicitedData in=" << ingress << " data=" << data.getName());
+}
+
+void
+Strategy::afterRebroadcastTimer(PendingRebroadcastTable::Key key, const Data& data)
+{
+  NFD_LOG_DEBUG("afterRebroadcastTimer data=" << data.getName());
+}
+
 void
 Strategy::afterReceiveNack(const FaceEndpoint& ingress, const lp::Nack& nack,
                            const shared_ptr<pit::Entry>& pitEntry)
@@ -251,7 +263,7 @@ void
 Strategy::sendDataToAll(const shared_ptr<pit::Entry>& pitEntry,
                         const FaceEndpoint& ingress, const Data& data)
 {
-  std::set<Face*> pendingDownstreams;
+  std::map<Face*, EndpointId> pendingDownstreams;
   auto now = time::steady_clock::now();
 
   // remember pending downstreams
@@ -261,13 +273,45 @@ Strategy::sendDataToAll(const shared_ptr<pit::Entry>& pitEntry,
           inRecord.getFace().getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) {
         continue;
       }
-      pendingDownstreams.emplace(&inRecord.getFace());
+      pendingDownstreams.emplace(&inRecord.getFace(), inRecord.getEndpoint());
     }
   }
 
   for (const auto& pendingDownstream : pendingDownstreams) {
-    this->sendData(pitEntry, data, FaceEndpoint(*pendingDownstream, 0));
+    this->sendData(pitEntry, data,
+                   FaceEndpoint(*pendingDownstream.first, pendingDownstream.second));
+  }
+}
+
+PendingRebroadcastTable::Entry&
+Strategy::scheduleRebroadcast(PendingRebroadcastTable::Key key, shared_ptr<const Data> data,
+                              time::nanoseconds delay, time::steady_clock::TimePoint expiry)
+{
+  BOOST_ASSERT(data != nullptr);
+  Forwarder& forwarder = m_forwarder;
+  auto eventId = m_forwarder.m_timerWheel.schedule(delay, [&forwarder, key, data = std::move(data)] {
+    forwarder.onRebroadcastTimer(key, *data);
+  });
+  ++m_forwarder.m_counters.nRebroadcastsScheduled;
+  return m_forwarder.m_pendingRebroadcasts.insert(key, eventId, expiry);
+}
+
+bool
+Strategy::cancelRebroadcast(PendingRebroadcastTable::Key key)
+{
+  if (!m_forwarder.m_pendingRebroadcasts.cancel(key)) {
+    return false;
   }
+  ++m_forwarder.m_counters.nRebroadcastsSuppressed;
+  m_forwarder.settleRebroadcast(key);
+  return true;
+}
+
+void
+Strategy::suppressRebroadcast(PendingRebroadcastTable::Key key)
+{
+  ++m_forwarder.m_counters.nRebroadcastsSuppressed;
+  m_forwarder.settleRebroadcast(key);
 }
 
 void
@@ -222,6 +222,52 @@ public: // triggers
   afterReceiveData(const shared_ptr<pit::Entry>& pitEntry,
                    const FaceEndpoint& ingress, const Data& data);
 
+  /** \brief trigger after unsolicited Data is received
+   *
+   *  This trigger is invoked when an incoming Data does not match any PIT entry,
+   *  after the unsolicited Data policy has decided whether to admit it into the ContentStore.
+   *  It allows push-based dissemination, such as DENM geo-broadcast, to be implemented as a
+   *  strategy for the namespace carrying the pushed Data.
+   *
+   *  The strategy may forward the Data via \c sendUnsolicitedData, either immediately or
+   *  after a contention delay via \c scheduleRebroadcast.
+   *
+   *  In the base class this method does nothing.
+   */
+  virtual void
+  afterReceiveUnsolicitedData(const FaceEndpoint& ingress, const Data& data);
+
+  /** \brief trigger before an incoming Data is decoded, when only its name is known
+   *
+   *  This trigger lets a strategy that receives many redundant unsolicited Data, such as
+   *  broadcast DENMs, drop them before the face decodes the rest of the packet and before the
+   *  incoming Data pipeline runs. If it returns false, the forwarder drops the Data unless it
+   *  matches a PIT entry.
+   *
+   *  The strategy should report its own decision, as the Data will not reach
+   *  \c afterReceiveUnsolicitedData. Tags set on \p tags are set on the Data once it is
+   *  decoded, so that what the strategy has learned from the name need not be computed again.
+   *
+   *  In the base class this method accepts every Data.
+   */
+  virtual bool
+  wantUnsolicitedData(const FaceEndpoint& ingress, const Name& dataName, const ndn::TagHost& tags)
+  {
+    return true;
+  }
+
+  /** \brief trigger after a rebroadcast timer set by \c scheduleRebroadcast has fired
+   *
+   *  The PendingRebroadcastTable record of \p key is no longer pending when this trigger is
+   *  invoked, but it still carries any StrategyInfo the strategy has placed on it. After this
+   *  trigger, the record is erased and its key is added to the DeadDenmList, unless the strategy
+   *  has scheduled the rebroadcast again.
+   *
+   *  In the base class this method does nothing.
+   */
+  virtual void
+  afterRebroadcastTimer(PendingRebroadcastTable::Key key, const Data& data);
+
   /** \brief trigger after Nack is received
    *
    *  This trigger is invoked when an incoming Nack is received in response to
@@ -262,6 +308,19 @@ public: // triggers
   virtual void
   afterNewNextHop(const fib::NextHop& nextHop, const shared_ptr<pit::Entry>& pitEntry);
 
+public: // simulation
+  /** \brief assign fixed stream numbers to the random variables of the strategy,
+   *         starting at \p stream
+   *  \return number of streams assigned
+   *
+   *  In the base class this method assigns none.
+   */
+  virtual int64_t
+  assignStreams(int64_t stream)
+  {
+    return 0;
+  }
+
 protected: // actions
   /** \brief send Interest to egress
    *  \param pitEntry PIT entry
@@ -336,6 +395,67 @@ protected: // actions
     m_forwarder.setExpiryTimer(pitEntry, duration);
   }
 
+  /** \brief send unsolicited \p data to \p egress
+   *  \param fields link-layer fields of this transmission, e.g. the position of this node;
+   *                they are not attached to \p data, which may be shared with the ContentStore
+   */
+  VIRTUAL_WITH_TESTS void
+  sendUnsolicitedData(const Data& data, const FaceEndpoint& egress, const EgressFields& fields = {})
+  {
+    m_forwarder.onOutgoingData(data, egress, fields);
+  }
+
+  /** \brief schedule a rebroadcast of unsolicited \p data after \p delay
+   *  \param key lookup key of the Data name in the PendingRebroadcastTable
+   *  \param expiry the point in time after which the Data no longer needs to be recognized
+   *  \return the PendingRebroadcastTable record, onto which StrategyInfo may be placed
+   *
+   *  When the timer fires, \c afterRebroadcastTimer is invoked on the effective strategy of
+   *  the Data name, which is responsible for sending the Data.
+   *
+   *  The timer holds a reference to \p data rather than a copy, so the same Data object and its
+   *  wire encoding are shared by the timer and every egress face. Callers holding a
+   *  <tt>const Data&</tt> from a pipeline obtain it with \c Data::shared_from_this.
+   */
+  PendingRebroadcastTable::Entry&
+  scheduleRebroadcast(PendingRebroadcastTable::Key key, shared_ptr<const Data> data,
+                      time::nanoseconds delay, time::steady_clock::TimePoint expiry);
+
+  /** \brief report a DENM forwarding decision to observers of Forwarder::afterDenmDecision
+   *  \param delay the rebroadcast delay of DenmDecision::SCHEDULED or DenmDecision::DEFERRED
+   */
+  void
+  reportDenmDecision(const Name& dataName, DenmDecision decision,
+                     time::nanoseconds delay = time::nanoseconds::zero())
+  {
+    m_forwarder.onDenmDecision(dataName, decision, delay);
+  }
+
+  /** \brief report a change of the DENM congestion control state of \p face
+   *         to observers of Forwarder::afterDccStateChange
+   */
+  void
+  reportDccState(const Face& face, DccState state, double cbr)
+  {
+    m_forwarder.onDccStateChange(face, state, cbr);
+  }
+
+  /** \brief cancel the pending rebroadcast of \p key
+   *  \return whether a pending rebroadcast was cancelled
+   *
+   *  The record of a cancelled rebroadcast, along with its StrategyInfo, is erased from the
+   *  PendingRebroadcastTable and its key is added to the DeadDenmList.
+   */
+  bool
+  cancelRebroadcast(PendingRebroadcastTable::Key key);
+
+  /** \brief record unsolicited Data that is not going to be rebroadcast
+   *
+   *  The key is added to the DeadDenmList, so that further copies are recognized.
+   */
+  void
+  suppressRebroadcast(PendingRebroadcastTable::Key key);
+
 protected: // accessors
   /** \brief performs a FIB lookup, considering Link object if present
    */
@@ -360,6 +480,40 @@ protected: // accessors
     return m_forwarder.m_faceTable;
   }
 
+  const DenmScopeTable&
+  getDenmScopeTable() const
+  {
+    return m_forwarder.m_denmScopeTable;
+  }
+
+  PendingRebroadcastTable&
+  getPendingRebroadcastTable()
+  {
+    return m_forwarder.m_pendingRebroadcasts;
+  }
+
+  DeadDenmList&
+  getDeadDenmList()
+  {
+    return m_forwarder.m_deadDenmList;
+  }
+
+  /** \return the node that owns the forwarder, or nullptr if it is not known
+   */
+  ns3::Ptr<ns3::Node>
+  getNode() const
+  {
+    return m_forwarder.getNode();
+  }
+
+  /** \return position of the node that owns the forwarder, or nullptr if it is not known
+   */
+  const ns3::ndn::PositionCache*
+  getPositionCache() const
+  {
+    return m_forwarder.m_positionCache;
+  }
+
 protected: // instance name
   struct ParsedInstanceName
   {
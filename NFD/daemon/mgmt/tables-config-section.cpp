@@ -99,6 +99,11 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     processNetworkRegionSection(*networkRegionSection, isDryRun);
   }
 
+  OptionalConfigSection denmScopeSection = section.get_child_optional("denm_scope");
+  if (denmScopeSection) {
+    processDenmScopeSection(*denmScopeSection, isDryRun);
+  }
+
   if (isDryRun) {
     return;
   }
@@ -165,4 +170,115 @@ TablesConfigSection::processNetworkRegionSection(const ConfigSection& section, b
   }
 }
 
+template<typename T>
+static T
+parseRequiredDenmScopeOption(const ConfigSection& section, const std::string& key)
+{
+  OptionalConfigSection node = section.get_child_optional(key);
+  if (!node) {
+    NDN_THROW(ConfigFile::Error("Missing option '" + key + "' in section 'denm_scope'"));
+  }
+  return ConfigFile::parseNumber<T>(*node, key, "denm_scope");
+}
+
+static DenmScopeTable::Scope
+parseDenmScope(const ConfigSection& section, const DenmScopeTable::Scope& defaultScope)
+{
+  DenmScopeTable::Scope scope = defaultScope;
+  OptionalConfigSection spatialRangeNode = section.get_child_optional("spatial_range");
+  if (spatialRangeNode) {
+    scope.spatialRange = ConfigFile::parseNumber<double>(*spatialRangeNode, "spatial_range",
+                                                         "denm_scope");
+  }
+  OptionalConfigSection temporalRangeNode = section.get_child_optional("temporal_range");
+  if (temporalRangeNode) {
+    scope.temporalRange = time::milliseconds(
+      ConfigFile::parseNumber<uint64_t>(*temporalRangeNode, "temporal_range", "denm_scope"));
+  }
+  return scope;
+}
+
+static void
+parseDenmScopeEntry(const ConfigSection& section, DenmScopeTable::ScopeArray& scopes)
+{
+  for (const auto& item : section) {
+    if (item.first != "app_type" && item.first != "content_type" &&
+        item.first != "spatial_range" && item.first != "temporal_range") {
+      NDN_THROW(ConfigFile::Error("Unrecognized option '" + item.first +
+                                  "' in 'scope' of section 'denm_scope'"));
+    }
+  }
+
+  auto appType = parseRequiredDenmScopeOption<uint32_t>(section, "app_type");
+  auto contentType = parseRequiredDenmScopeOption<uint32_t>(section, "content_type");
+  if (appType >= DenmScopeTable::N_APP_TYPES || contentType >= DenmScopeTable::N_CONTENT_TYPES) {
+    NDN_THROW(ConfigFile::Error("DENM type " + to_string(appType) + "/" + to_string(contentType) +
+                                " out of range in section 'denm_scope'"));
+  }
+
+  size_t index = DenmScopeTable::getIndex(appType, contentType);
+  scopes[index] = parseDenmScope(section, scopes[index]);
+}
+
+void
+TablesConfigSection::processDenmScopeSection(const ConfigSection& section, bool isDryRun)
+{
+  DenmScopeTable::ScopeArray scopes;
+  scopes.fill(parseDenmScope(section, DenmScopeTable::DEFAULT_SCOPE));
+
+  for (const auto& item : section) {
+    if (item.first == "scope") {
+      parseDenmScopeEntry(item.second, scopes);
+    }
+    else if (item.first != "region" && item.first != "spatial_range" &&
+             item.first != "temporal_range") {
+      NDN_THROW(ConfigFile::Error("Unrecognized option '" + item.first + "' in section 'denm_scope'"));
+    }
+  }
+
+  DenmScopeTable table(scopes);
+
+  // regions start from the complete base scopes, so they are parsed in a second pass
+  for (const auto& item : section) {
+    if (item.first != "region") {
+      continue;
+    }
+
+    const ConfigSection& regionSection = item.second;
+    auto minX = parseRequiredDenmScopeOption<double>(regionSection, "min_x");
+    auto minY = parseRequiredDenmScopeOption<double>(regionSection, "min_y");
+    auto maxX = parseRequiredDenmScopeOption<double>(regionSection, "max_x");
+    auto maxY = parseRequiredDenmScopeOption<double>(regionSection, "max_y");
+    if (minX > maxX || minY > maxY) {
+      NDN_THROW(ConfigFile::Error("Empty 'region' in section 'denm_scope'"));
+    }
+    auto& region = table.addRegion(minX, minY, maxX, maxY);
+
+    // spatial_range and temporal_range of the region apply to every DENM type in the region,
+    // then the scopes of the region override them
+    for (auto& scope : region.scopes) {
+      scope = parseDenmScope(regionSection, scope);
+    }
+
+    for (const auto& regionItem : regionSection) {
+      if (regionItem.first == "scope") {
+        parseDenmScopeEntry(regionItem.second, region.scopes);
+      }
+      else if (regionItem.first != "min_x" && regionItem.first != "min_y" &&
+               regionItem.first != "max_x" && regionItem.first != "max_y" &&
+               regionItem.first != "spatial_range" && regionItem.first != "temporal_range") {
+        NDN_THROW(ConfigFile::Error("Unrecognized option '" + regionItem.first +
+                                    "' in 'region' of section 'denm_scope'"));
+      }
+    }
+  }
+
+  if (isDryRun) {
+    return;
+  }
+
+  m_forwarder.getDenmScopeTable() = std::move(table);
+  m_forwarder.getDeadDenmList().setWindow(m_forwarder.getDenmScopeTable().getMaxTemporalRange());
+}
+
 } // namespace nfd
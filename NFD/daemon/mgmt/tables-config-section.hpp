@@ -54,6 +54,32 @@ namespace nfd {
  *      /example/region1
  *      /example/region2
  *    }
+ *
+ *    denm_scope
+ *    {
+ *      spatial_range 200    ; meters, applies to every DENM type
+ *      temporal_range 5000  ; milliseconds
+ *      scope
+ *      {
+ *        app_type 0
+ *        content_type 1
+ *        spatial_range 500
+ *      }
+ *      region
+ *      {
+ *        min_x 0
+ *        min_y 0
+ *        max_x 1000
+ *        max_y 50
+ *        spatial_range 100  ; applies to every DENM type whose event is in the region
+ *        scope
+ *        {
+ *          app_type 0
+ *          content_type 1
+ *          temporal_range 1000
+ *        }
+ *      }
+ *    }
  *  }
  *  \endcode
  *
@@ -62,6 +88,8 @@ namespace nfd {
  *      defaults are used if an option is omitted.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
+ *  \li denm_scope replaces the DenmScopeTable; it's kept unchanged if the section is omitted.
+ *      A region starts from the scopes outside of any region.
  *
  *  It's necessary to call \p ensureConfigured() after initial configuration and
  *  configuration reload, so that the correct defaults are applied in case
@@ -91,6 +119,9 @@ private:
   void
   processNetworkRegionSection(const ConfigSection& section, bool isDryRun);
 
+  void
+  processDenmScopeSection(const ConfigSection& section, bool isDryRun);
+
 private:
   static const size_t DEFAULT_CS_MAX_PACKETS;
 
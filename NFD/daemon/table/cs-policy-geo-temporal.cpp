@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-policy-geo-temporal.hpp"
+#include "cs.hpp"
+#include "../../../model/ndn-position-cache.hpp"
+#include "common/global.hpp"
+#include "fw/denm-name.hpp"
+
+#include <cmath>
+
+namespace nfd {
+namespace cs {
+namespace geo_temporal {
+
+const std::string GeoTemporalPolicy::POLICY_NAME = "geo-temporal";
+NFD_REGISTER_CS_POLICY(GeoTemporalPolicy);
+
+static const DenmScopeTable&
+getDefaultScopeTable()
+{
+  static const DenmScopeTable table;
+  return table;
+}
+
+GeoTemporalPolicy::GeoTemporalPolicy()
+  : Policy(POLICY_NAME)
+  , m_scopeTable(&getDefaultScopeTable())
+{
+}
+
+void
+GeoTemporalPolicy::setContext(const DenmScopeTable& scopeTable,
+                              const ns3::ndn::PositionCache* positionCache)
+{
+  m_scopeTable = &scopeTable;
+  m_positionCache = positionCache;
+}
+
+void
+GeoTemporalPolicy::doAfterInsert(EntryRef i)
+{
+  EntryInfo info;
+  if (!this->rank(i, info)) {
+    ++m_nRejected;
+    this->emitSignal(beforeEvict, i);
+    return;
+  }
+
+  m_queue.insert(info);
+  this->evictEntries();
+}
+
+void
+GeoTemporalPolicy::doAfterRefresh(EntryRef i)
+{
+  this->rerank(i);
+}
+
+void
+GeoTemporalPolicy::doBeforeErase(EntryRef i)
+{
+  m_queue.erase(i);
+  this->scheduleExpiry();
+}
+
+void
+GeoTemporalPolicy::doBeforeUse(EntryRef i)
+{
+  this->rerank(i);
+}
+
+void
+GeoTemporalPolicy::evictEntries()
+{
+  BOOST_ASSERT(this->getCs() != nullptr);
+
+  auto& byRelevance = m_queue.get<2>();
+  while (this->getCs()->size() > this->getLimit()) {
+    BOOST_ASSERT(!byRelevance.empty());
+    EntryRef i = byRelevance.begin()->ref;
+    byRelevance.erase(byRelevance.begin());
+    this->emitSignal(beforeEvict, i);
+  }
+  this->scheduleExpiry();
+}
+
+bool
+GeoTemporalPolicy::rank(EntryRef i, EntryInfo& info) const
+{
+  auto now = time::steady_clock::now();
+  const Data& data = i->getData();
+  info.ref = i;
+
+  auto denmTag = fw::getDenmName(data);
+  const DenmScopeTable::Scope* scope = nullptr;
+  if (denmTag != nullptr) {
+    const fw::DenmName& denm = denmTag->get();
+    scope = m_scopeTable->find(denm.appType, denm.contentType, denm.eventX, denm.eventY);
+  }
+  if (scope == nullptr) {
+    info.expiry = time::steady_clock::TimePoint::max();
+    info.relevantUntil = now + data.getFreshnessPeriod();
+    return true;
+  }
+
+  const fw::DenmName& denm = denmTag->get();
+  info.expiry = time::steady_clock::TimePoint(denm.referenceTime + scope->temporalRange);
+  info.relevantUntil = now;
+  if (info.expiry <= now) {
+    return false;
+  }
+  if (m_positionCache == nullptr) {
+    info.relevantUntil = info.expiry;
+    return true;
+  }
+
+  ns3::Vector self = m_positionCache->getPosition();
+  const ns3::Vector& velocity = m_positionCache->getVelocity();
+  double wx = self.x - denm.eventX;
+  double wy = self.y - denm.eventY;
+  double c = wx * wx + wy * wy - scope->spatialRange * scope->spatialRange;
+  if (c >= 0.0) {
+    return false;
+  }
+
+  info.relevantUntil = info.expiry;
+  double a = velocity.x * velocity.x + velocity.y * velocity.y;
+  if (a > 0.0) {
+    // the node leaves the range at the positive root of |w + v t| = spatialRange,
+    // which exists because the node is inside the range (c < 0)
+    double b = 2.0 * (wx * velocity.x + wy * velocity.y);
+    double exitSeconds = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
+    double remainingSeconds = time::duration_cast<time::duration<double>>(info.expiry - now).count();
+    if (exitSeconds < remainingSeconds) {
+      info.relevantUntil = now + time::nanoseconds(static_cast<int64_t>(exitSeconds * 1e9));
+    }
+  }
+  return true;
+}
+
+void
+GeoTemporalPolicy::rerank(EntryRef i)
+{
+  auto it = m_queue.find(i);
+  BOOST_ASSERT(it != m_queue.end());
+
+  // an entry that has gone out of range stays in the CS, but is the first to be evicted
+  EntryInfo info;
+  this->rank(i, info);
+  m_queue.modify(it, [&info] (EntryInfo& entry) { entry = info; });
+  this->scheduleExpiry();
+}
+
+void
+GeoTemporalPolicy::evictExpired()
+{
+  m_scheduledExpiry = time::steady_clock::TimePoint::max();
+
+  auto now = time::steady_clock::now();
+  auto& byExpiry = m_queue.get<1>();
+  while (!byExpiry.empty() && byExpiry.begin()->expiry <= now) {
+    EntryRef i = byExpiry.begin()->ref;
+    byExpiry.erase(byExpiry.begin());
+    ++m_nExpired;
+    this->emitSignal(beforeEvict, i);
+  }
+  this->scheduleExpiry();
+}
+
+void
+GeoTemporalPolicy::scheduleExpiry()
+{
+  const auto& byExpiry = m_queue.get<1>();
+  auto next = byExpiry.empty() ? time::steady_clock::TimePoint::max() : byExpiry.begin()->expiry;
+  if (next == m_scheduledExpiry) {
+    return;
+  }
+
+  m_scheduledExpiry = next;
+  if (next == time::steady_clock::TimePoint::max()) {
+    m_expiryEvent.cancel();
+    return;
+  }
+  auto delay = std::max(time::nanoseconds(next - time::steady_clock::now()), 0_ns);
+  m_expiryEvent = getScheduler().schedule(delay, [this] { this->evictExpired(); });
+}
+
+} // namespace geo_temporal
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,177 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_POLICY_GEO_TEMPORAL_HPP
+#define NFD_DAEMON_TABLE_CS_POLICY_GEO_TEMPORAL_HPP
+
+#include "cs-policy.hpp"
+#include "denm-scope-table.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+
+namespace ns3 {
+namespace ndn {
+class PositionCache;
+} // namespace ndn
+} // namespace ns3
+
+namespace nfd {
+namespace cs {
+namespace geo_temporal {
+
+struct EntryInfo
+{
+  Policy::EntryRef ref;
+  /// when the temporal validity of the DENM ends; TimePoint::max() for other Data
+  time::steady_clock::TimePoint expiry;
+  /// when the entry is expected to stop being useful to this node
+  time::steady_clock::TimePoint relevantUntil;
+};
+
+using Queue = boost::multi_index_container<
+                EntryInfo,
+                boost::multi_index::indexed_by<
+                  boost::multi_index::ordered_unique<
+                    boost::multi_index::member<EntryInfo, Policy::EntryRef, &EntryInfo::ref>>,
+                  boost::multi_index::ordered_non_unique<
+                    boost::multi_index::member<EntryInfo, time::steady_clock::TimePoint,
+                                               &EntryInfo::expiry>>,
+                  boost::multi_index::ordered_non_unique<
+                    boost::multi_index::member<EntryInfo, time::steady_clock::TimePoint,
+                                               &EntryInfo::relevantUntil>>
+                >
+              >;
+
+/** \brief Geo-temporal replacement policy for DENM Data
+ *
+ *  This policy keeps the DENMs that are still useful around the node. A DENM expires when
+ *  the temporal range of its scope in the DenmScopeTable has elapsed since its reference time,
+ *  and it is out of range when the node is farther from the event than the spatial range.
+ *
+ *  A DENM that is expired or out of range is not admitted. Every admitted entry is given a
+ *  relevance deadline: the earlier of its expiry and the time the node is expected to leave
+ *  the spatial range, extrapolated from the current position and velocity of the node. A
+ *  vehicle heading towards the event therefore keeps the DENM longer than one driving away,
+ *  and a stationary node keeps it until it expires. The deadline is recomputed whenever the
+ *  entry is refreshed or used. Other Data are given a deadline at the end of their freshness
+ *  period, so they are evicted before the DENMs that remain relevant longer.
+ *
+ *  When the CS is full, the entry with the earliest relevance deadline is evicted. Expired
+ *  DENMs are evicted proactively by a timer, so they never occupy room a valid DENM could use.
+ *
+ *  Without a position, e.g. in a CS that is not attached to a node, distance and heading are
+ *  ignored and only the temporal validity is considered.
+ */
+class GeoTemporalPolicy : public Policy
+{
+public:
+  GeoTemporalPolicy();
+
+  /** \brief set the scopes and the position used to rank entries
+   *  \param scopeTable the DenmScopeTable of the forwarder, which must outlive the policy
+   *  \param positionCache the position of the node, or nullptr if it is not known
+   */
+  void
+  setContext(const DenmScopeTable& scopeTable, const ns3::ndn::PositionCache* positionCache);
+
+  /** \return number of DENMs rejected on admission
+   */
+  uint64_t
+  getNRejected() const
+  {
+    return m_nRejected;
+  }
+
+  /** \return number of entries evicted because their DENM has expired
+   */
+  uint64_t
+  getNExpired() const
+  {
+    return m_nExpired;
+  }
+
+public:
+  static const std::string POLICY_NAME;
+
+private:
+  void
+  doAfterInsert(EntryRef i) override;
+
+  void
+  doAfterRefresh(EntryRef i) override;
+
+  void
+  doBeforeErase(EntryRef i) override;
+
+  void
+  doBeforeUse(EntryRef i) override;
+
+  void
+  evictEntries() override;
+
+private:
+  /** \brief compute the expiry and relevance deadline of \p i
+   *  \return false if the Data is a DENM that is expired or out of range
+   */
+  bool
+  rank(EntryRef i, EntryInfo& info) const;
+
+  /** \brief recompute the relevance deadline of an entry in the queue
+   */
+  void
+  rerank(EntryRef i);
+
+  /** \brief evict expired DENMs and schedule the timer for the next expiry
+   */
+  void
+  evictExpired();
+
+  /** \brief make sure the expiry timer fires at the earliest expiry in the queue
+   */
+  void
+  scheduleExpiry();
+
+private:
+  Queue m_queue;
+  const DenmScopeTable* m_scopeTable;
+  const ns3::ndn::PositionCache* m_positionCache = nullptr;
+
+  scheduler::ScopedEventId m_expiryEvent;
+  time::steady_clock::TimePoint m_scheduledExpiry = time::steady_clock::TimePoint::max();
+
+  uint64_t m_nRejected = 0;
+  uint64_t m_nExpired = 0;
+};
+
+} // namespace geo_temporal
+
+using geo_temporal::GeoTemporalPolicy;
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_POLICY_GEO_TEMPORAL_HPP
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dead-denm-list.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace nfd {
+
+const time::nanoseconds DeadDenmList::DEFAULT_WINDOW = 10_s;
+const time::nanoseconds DeadDenmList::MIN_WINDOW = 1_ms;
+const size_t DeadDenmList::DEFAULT_N_CELLS = 1 << 13;
+const size_t DeadDenmList::N_HASHES = 4;
+
+// counters stick at this value, because their true count is no longer known
+static const uint8_t SATURATED = std::numeric_limits<uint8_t>::max();
+
+DeadDenmList::DeadDenmList(time::nanoseconds window, size_t nCells)
+  : m_windowStart(time::steady_clock::now())
+{
+  if (nCells == 0) {
+    NDN_THROW(std::invalid_argument("nCells must be positive"));
+  }
+  this->setWindow(window);
+  for (Filter& filter : m_filters) {
+    filter.cells.resize(nCells);
+  }
+}
+
+void
+DeadDenmList::setWindow(time::nanoseconds window)
+{
+  m_window = std::max(window, MIN_WINDOW);
+}
+
+template<typename F>
+void
+DeadDenmList::forEachCell(Key key, const F& f) const
+{
+  // the key is already a hash of the Data name; its halves seed double hashing
+  uint64_t h1 = key & 0xFFFFFFFF;
+  uint64_t h2 = (key >> 32) | 1;
+  size_t nCells = m_filters[0].cells.size();
+  for (size_t i = 0; i < N_HASHES; ++i) {
+    f((h1 + i * h2) % nCells);
+  }
+}
+
+bool
+DeadDenmList::has(Key key)
+{
+  this->rotate();
+  ++m_nLookups;
+
+  for (const Filter& filter : m_filters) {
+    bool isFound = true;
+    forEachCell(key, [&] (size_t i) { isFound = isFound && filter.cells[i] > 0; });
+    if (isFound) {
+      ++m_nHits;
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+DeadDenmList::add(Key key)
+{
+  this->rotate();
+
+  Filter& filter = getCurrent();
+  forEachCell(key, [&filter] (size_t i) {
+    uint8_t& cell = filter.cells[i];
+    if (cell == 0) {
+      ++filter.nNonZero;
+    }
+    if (cell < SATURATED) {
+      ++cell;
+    }
+  });
+  ++filter.nKeys;
+}
+
+void
+DeadDenmList::remove(Key key)
+{
+  this->rotate();
+
+  Filter& filter = getCurrent();
+  bool isFound = true;
+  forEachCell(key, [&] (size_t i) { isFound = isFound && filter.cells[i] > 0; });
+  if (!isFound) {
+    return;
+  }
+
+  forEachCell(key, [&filter] (size_t i) {
+    uint8_t& cell = filter.cells[i];
+    if (cell < SATURATED && --cell == 0) {
+      --filter.nNonZero;
+    }
+  });
+  --filter.nKeys;
+}
+
+void
+DeadDenmList::rotate()
+{
+  auto now = time::steady_clock::now();
+  if (now - m_windowStart < m_window) {
+    return;
+  }
+
+  // after two idle windows, the previous filter is stale as well
+  if (now - m_windowStart >= 2 * m_window) {
+    Filter& current = getCurrent();
+    std::fill(current.cells.begin(), current.cells.end(), 0);
+    current.nKeys = current.nNonZero = 0;
+  }
+
+  m_current = 1 - m_current;
+  Filter& next = getCurrent();
+  std::fill(next.cells.begin(), next.cells.end(), 0);
+  next.nKeys = next.nNonZero = 0;
+  m_windowStart = now;
+}
+
+double
+DeadDenmList::getOccupancy() const
+{
+  const Filter& current = m_filters[m_current];
+  return static_cast<double>(current.nNonZero) / current.cells.size();
+}
+
+double
+DeadDenmList::estimateFalsePositiveProbability(const Filter& filter)
+{
+  // a key is reported if all of its counters are non-zero
+  return std::pow(static_cast<double>(filter.nNonZero) / filter.cells.size(), N_HASHES);
+}
+
+double
+DeadDenmList::getFalsePositiveProbability() const
+{
+  return 1.0 - (1.0 - estimateFalsePositiveProbability(m_filters[0])) *
+               (1.0 - estimateFalsePositiveProbability(m_filters[1]));
+}
+
+} // namespace nfd
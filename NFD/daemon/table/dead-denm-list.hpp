@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_DEAD_DENM_LIST_HPP
+#define NFD_DAEMON_TABLE_DEAD_DENM_LIST_HPP
+
+#include "core/common.hpp"
+
+#include <array>
+
+namespace nfd {
+
+/** \brief Represents the Dead DENM List
+ *
+ *  The Dead DENM List supplements the PendingRebroadcastTable for duplicate detection of
+ *  unsolicited DENM Data, which has no Nonce. Once a DENM is settled, i.e. it is not going to
+ *  be rebroadcast or its rebroadcast has been sent or cancelled, its record leaves the
+ *  PendingRebroadcastTable and its key is added here, so that further copies are recognized
+ *  as duplicates.
+ *
+ *  Keys are the 64-bit hashes of the Data names, which identify a DENM by its event and
+ *  sequence number. They are stored in a pair of counting Bloom filters of fixed size: new keys
+ *  go into the current filter, lookups check both. Every \c window the older filter is cleared
+ *  and becomes the current one, so a key is remembered for at least one and at most two
+ *  windows. The window should be no shorter than the longest temporal range in the
+ *  DenmScopeTable, since a copy received after the temporal range is out of scope anyway.
+ *
+ *  Lookups and insertions cost a fixed number of counter accesses and memory is bounded by
+ *  the number of cells. There could be false positives, whose probability grows with the
+ *  occupancy of the filters; it is estimated by getFalsePositiveProbability().
+ */
+class DeadDenmList : noncopyable
+{
+public:
+  using Key = uint64_t;
+
+  /** \brief constructs the Dead DENM List
+   *  \param window how long a key is at least remembered
+   *  \param nCells number of counters of each filter
+   *  \throw std::invalid_argument \p nCells is zero
+   */
+  explicit
+  DeadDenmList(time::nanoseconds window = DEFAULT_WINDOW, size_t nCells = DEFAULT_N_CELLS);
+
+  /** \brief determines whether \p key has been recorded within the last one to two windows
+   */
+  bool
+  has(Key key);
+
+  /** \brief records \p key
+   */
+  void
+  add(Key key);
+
+  /** \brief forgets \p key, if it has been recorded in the current window
+   *
+   *  This is only accurate if \p key was added once, since the counters do not distinguish
+   *  keys sharing all of their cells.
+   */
+  void
+  remove(Key key);
+
+  /** \brief changes the window, which takes effect at the next rotation
+   *
+   *  The window is clamped to MIN_WINDOW.
+   */
+  void
+  setWindow(time::nanoseconds window);
+
+  time::nanoseconds
+  getWindow() const
+  {
+    return m_window;
+  }
+
+  /** \return number of keys added in the current and the previous window
+   */
+  size_t
+  size() const
+  {
+    return m_filters[0].nKeys + m_filters[1].nKeys;
+  }
+
+  /** \return fraction of non-zero counters of the current filter
+   */
+  double
+  getOccupancy() const;
+
+  /** \return estimated probability that has() returns true for a key that has not been added
+   */
+  double
+  getFalsePositiveProbability() const;
+
+  /** \return number of lookups
+   */
+  uint64_t
+  getNLookups() const
+  {
+    return m_nLookups;
+  }
+
+  /** \return number of lookups that found the key, including false positives
+   */
+  uint64_t
+  getNHits() const
+  {
+    return m_nHits;
+  }
+
+public:
+  /// Default window
+  static const time::nanoseconds DEFAULT_WINDOW;
+  /// Minimum window
+  static const time::nanoseconds MIN_WINDOW;
+  /// Default number of counters of each filter
+  static const size_t DEFAULT_N_CELLS;
+  /// Number of counters a key is hashed to
+  static const size_t N_HASHES;
+
+private:
+  struct Filter
+  {
+    std::vector<uint8_t> cells;
+    size_t nKeys = 0;
+    size_t nNonZero = 0;
+  };
+
+  /** \brief rotate the filters if the current window has elapsed
+   */
+  void
+  rotate();
+
+  /** \brief invoke \p f with the index of every counter of \p key
+   */
+  template<typename F>
+  void
+  forEachCell(Key key, const F& f) const;
+
+  static double
+  estimateFalsePositiveProbability(const Filter& filter);
+
+  Filter&
+  getCurrent()
+  {
+    return m_filters[m_current];
+  }
+
+private:
+  time::nanoseconds m_window;
+  time::steady_clock::TimePoint m_windowStart;
+  std::array<Filter, 2> m_filters;
+  size_t m_current = 0;
+
+  uint64_t m_nLookups = 0;
+  uint64_t m_nHits = 0;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_DEAD_DENM_LIST_HPP
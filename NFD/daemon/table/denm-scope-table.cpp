@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "denm-scope-table.hpp"
+
+namespace nfd {
+
+constexpr size_t DenmScopeTable::N_APP_TYPES;
+constexpr size_t DenmScopeTable::N_CONTENT_TYPES;
+const DenmScopeTable::Scope DenmScopeTable::DEFAULT_SCOPE = {201.0, 20_ms};
+
+DenmScopeTable::DenmScopeTable()
+{
+  m_scopes.fill(DEFAULT_SCOPE);
+}
+
+DenmScopeTable::DenmScopeTable(const ScopeArray& scopes)
+  : m_scopes(scopes)
+{
+}
+
+const DenmScopeTable::Scope*
+DenmScopeTable::find(uint32_t appType, uint32_t contentType, double eventX, double eventY) const
+{
+  const Scope* scope = this->find(appType, contentType);
+  if (scope == nullptr || m_regions.empty()) {
+    return scope;
+  }
+
+  for (const Region& region : m_regions) {
+    if (region.contains(eventX, eventY)) {
+      return &region.scopes[appType * N_CONTENT_TYPES + contentType];
+    }
+  }
+  return scope;
+}
+
+void
+DenmScopeTable::setDefault(const Scope& scope)
+{
+  m_scopes.fill(scope);
+}
+
+void
+DenmScopeTable::set(uint32_t appType, uint32_t contentType, const Scope& scope)
+{
+  m_scopes[getIndex(appType, contentType)] = scope;
+}
+
+DenmScopeTable::Region&
+DenmScopeTable::addRegion(double minX, double minY, double maxX, double maxY)
+{
+  m_regions.push_back({minX, minY, maxX, maxY, m_scopes});
+  return m_regions.back();
+}
+
+time::milliseconds
+DenmScopeTable::getMaxTemporalRange() const
+{
+  time::milliseconds maxRange = 0_ms;
+  for (const Scope& scope : m_scopes) {
+    maxRange = std::max(maxRange, scope.temporalRange);
+  }
+  for (const Region& region : m_regions) {
+    for (const Scope& scope : region.scopes) {
+      maxRange = std::max(maxRange, scope.temporalRange);
+    }
+  }
+  return maxRange;
+}
+
+size_t
+DenmScopeTable::getIndex(uint32_t appType, uint32_t contentType)
+{
+  if (appType >= N_APP_TYPES || contentType >= N_CONTENT_TYPES) {
+    NDN_THROW(std::out_of_range("DENM appType or contentType out of range"));
+  }
+  return appType * N_CONTENT_TYPES + contentType;
+}
+
+} // namespace nfd
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_DENM_SCOPE_TABLE_HPP
+#define NFD_DAEMON_TABLE_DENM_SCOPE_TABLE_HPP
+
+#include "core/common.hpp"
+
+#include <array>
+
+namespace nfd {
+
+/** \brief stores the spatio-temporal dissemination scope of DENM Data
+ *
+ *  Every (appType, contentType) pair of a DENM name maps to a spatial range, beyond which
+ *  the DENM is not forwarded, and a temporal range, after which the DENM is considered
+ *  expired. Scopes are kept in a flat array indexed by [appType][contentType], so a lookup
+ *  is a bounds check and an array access.
+ *
+ *  Optional rectangular regions override the scopes of DENMs whose event is located inside
+ *  the region. Regions are matched in the order they were added; the base scopes apply when
+ *  no region contains the event.
+ *
+ *  The table is populated once per node from the 'denm_scope' subsection of the 'tables'
+ *  config section, see TablesConfigSection.
+ */
+class DenmScopeTable
+{
+public:
+  struct Scope
+  {
+    double spatialRange; ///< in meters
+    time::milliseconds temporalRange;
+  };
+
+  static constexpr size_t N_APP_TYPES = 4;
+  static constexpr size_t N_CONTENT_TYPES = 4;
+
+  using ScopeArray = std::array<Scope, N_APP_TYPES * N_CONTENT_TYPES>;
+
+  struct Region
+  {
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+    ScopeArray scopes;
+
+    bool
+    contains(double x, double y) const
+    {
+      return x >= minX && x <= maxX && y >= minY && y <= maxY;
+    }
+  };
+
+  /** \brief constructs a table where every scope equals DEFAULT_SCOPE
+   */
+  DenmScopeTable();
+
+  /** \brief constructs a table with the specified base scopes
+   */
+  explicit
+  DenmScopeTable(const ScopeArray& scopes);
+
+  /** \brief find the base scope of a DENM type
+   *  \return the scope, or nullptr if \p appType or \p contentType is out of range
+   */
+  const Scope*
+  find(uint32_t appType, uint32_t contentType) const
+  {
+    if (appType >= N_APP_TYPES || contentType >= N_CONTENT_TYPES) {
+      return nullptr;
+    }
+    return &m_scopes[appType * N_CONTENT_TYPES + contentType];
+  }
+
+  /** \brief find the scope of a DENM type for an event located at (\p eventX, \p eventY)
+   *  \return the scope of the first region that contains the event, or the base scope
+   */
+  const Scope*
+  find(uint32_t appType, uint32_t contentType, double eventX, double eventY) const;
+
+  /** \brief set the scope of every DENM type, outside of any region
+   */
+  void
+  setDefault(const Scope& scope);
+
+  /** \brief set the base scope of a DENM type
+   *  \throw std::out_of_range \p appType or \p contentType is out of range
+   */
+  void
+  set(uint32_t appType, uint32_t contentType, const Scope& scope);
+
+  /** \brief add a region override
+   *  \return the new region, whose scopes are initialized from the base scopes
+   */
+  Region&
+  addRegion(double minX, double minY, double maxX, double maxY);
+
+  const std::vector<Region>&
+  getRegions() const
+  {
+    return m_regions;
+  }
+
+  /** \return the longest temporal range among all scopes
+   */
+  time::milliseconds
+  getMaxTemporalRange() const;
+
+  static size_t
+  getIndex(uint32_t appType, uint32_t contentType);
+
+public:
+  static const Scope DEFAULT_SCOPE;
+
+private:
+  ScopeArray m_scopes;
+  std::vector<Region> m_regions;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_DENM_SCOPE_TABLE_HPP
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pending-rebroadcast-table.hpp"
+#include "common/city-hash.hpp"
+
+namespace nfd {
+
+PendingRebroadcastTable::Key
+PendingRebroadcastTable::computeKey(const Name& name)
+{
+  const Block& nameWire = name.wireEncode();
+  return CityHash64(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size());
+}
+
+const PendingRebroadcastTable::Entry*
+PendingRebroadcastTable::find(Key key) const
+{
+  auto it = m_table.find(key);
+  if (it == m_table.end() || it->second.m_expiry <= time::steady_clock::now()) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+PendingRebroadcastTable::Entry*
+PendingRebroadcastTable::find(Key key)
+{
+  return const_cast<Entry*>(const_cast<const PendingRebroadcastTable*>(this)->find(key));
+}
+
+PendingRebroadcastTable::Entry&
+PendingRebroadcastTable::insert(Key key, const TimerWheel::EventId& eventId,
+                                time::steady_clock::TimePoint expiry)
+{
+  Entry& entry = this->insert(key, expiry);
+  entry.m_eventId = eventId;
+  entry.m_isPending = true;
+  ++m_nPending;
+  return entry;
+}
+
+PendingRebroadcastTable::Entry&
+PendingRebroadcastTable::insert(Key key, time::steady_clock::TimePoint expiry)
+{
+  this->evictExpired();
+
+  Entry& entry = m_table[key];
+  if (entry.m_isPending) {
+    entry.m_eventId.cancel();
+    this->settle(entry);
+  }
+  entry.clearStrategyInfo();
+  entry.m_expiry = expiry;
+
+  m_expiryQueue.emplace(expiry, key);
+  return entry;
+}
+
+bool
+PendingRebroadcastTable::cancel(Key key)
+{
+  auto it = m_table.find(key);
+  if (it == m_table.end() || !it->second.m_isPending) {
+    return false;
+  }
+
+  it->second.m_eventId.cancel();
+  this->settle(it->second);
+  return true;
+}
+
+void
+PendingRebroadcastTable::markFired(Key key)
+{
+  auto it = m_table.find(key);
+  if (it != m_table.end()) {
+    this->settle(it->second);
+  }
+}
+
+void
+PendingRebroadcastTable::erase(Key key)
+{
+  auto it = m_table.find(key);
+  if (it == m_table.end()) {
+    return;
+  }
+
+  if (it->second.m_isPending) {
+    it->second.m_eventId.cancel();
+    this->settle(it->second);
+  }
+  // the expiry queue still refers to the key; evictExpired skips keys that are gone
+  m_table.erase(it);
+}
+
+void
+PendingRebroadcastTable::evictExpired()
+{
+  auto now = time::steady_clock::now();
+  while (!m_expiryQueue.empty() && m_expiryQueue.top().first <= now) {
+    Key key = m_expiryQueue.top().second;
+    m_expiryQueue.pop();
+
+    auto it = m_table.find(key);
+    // the record may have been replaced by a later insert with a different expiry
+    if (it == m_table.end() || it->second.m_expiry > now) {
+      continue;
+    }
+
+    if (it->second.m_isPending) {
+      it->second.m_eventId.cancel();
+      this->settle(it->second);
+    }
+    m_table.erase(it);
+  }
+}
+
+void
+PendingRebroadcastTable::settle(Entry& entry)
+{
+  if (entry.m_isPending) {
+    entry.m_isPending = false;
+    entry.m_eventId = TimerWheel::EventId();
+    BOOST_ASSERT(m_nPending > 0);
+    --m_nPending;
+  }
+}
+
+} // namespace nfd
@@ -0,0 +1,180 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PENDING_REBROADCAST_TABLE_HPP
+#define NFD_DAEMON_TABLE_PENDING_REBROADCAST_TABLE_HPP
+
+#include "strategy-info-host.hpp"
+#include "common/timer-wheel.hpp"
+
+#include <ndn-cxx/tag.hpp>
+
+#include <queue>
+
+namespace nfd {
+
+/** \brief Represents the pending-rebroadcast table of unsolicited DENM Data
+ *
+ *  When an unsolicited DENM is accepted for rebroadcast, the strategy schedules a contention
+ *  timer and records it here. A later copy of the same Data may cancel the pending timer,
+ *  suppressing the rebroadcast. Strategies can attach per-Data state to the records,
+ *  such as the positions of neighbors already heard forwarding the same Data.
+ *
+ *  Records are keyed by a 64-bit hash of the Data name, computed once per packet by
+ *  computeKey(). As in DeadNonceList, there could be false positives, but the probability
+ *  is small. Once its timer fires or is cancelled, a record no longer holds an event. The
+ *  forwarder then erases it and records the key in the DeadDenmList, which recognizes further
+ *  copies in bounded memory. Records that are not erased earlier are erased when the temporal
+ *  validity of the DENM expires, since any copy received after that point is dropped by the
+ *  strategy anyway.
+ */
+class PendingRebroadcastTable : noncopyable
+{
+public:
+  using Key = uint64_t;
+
+  class Entry : public StrategyInfoHost
+  {
+  public:
+    /** \return whether the rebroadcast timer is still scheduled
+     */
+    bool
+    isPending() const
+    {
+      return m_isPending;
+    }
+
+    const TimerWheel::EventId&
+    getEventId() const
+    {
+      return m_eventId;
+    }
+
+    time::steady_clock::TimePoint
+    getExpiry() const
+    {
+      return m_expiry;
+    }
+
+  private:
+    TimerWheel::EventId m_eventId;
+    time::steady_clock::TimePoint m_expiry;
+    bool m_isPending = false;
+
+    friend class PendingRebroadcastTable;
+  };
+
+  /** \brief compute the lookup key of a Data name
+   */
+  static Key
+  computeKey(const Name& name);
+
+  /** \brief find the record of \p key
+   *  \return the record, or nullptr if the Data has not been seen or its record has expired
+   */
+  const Entry*
+  find(Key key) const;
+
+  /** \brief find the record of \p key
+   *  \return the record, or nullptr if the Data has not been seen or its record has expired
+   */
+  Entry*
+  find(Key key);
+
+  /** \brief record a scheduled rebroadcast
+   *  \param key lookup key of the Data name
+   *  \param eventId the scheduled rebroadcast event
+   *  \param expiry the point in time after which the record is no longer needed
+   *  \return the new record
+   *
+   *  An existing record of \p key is replaced, along with its StrategyInfo items.
+   */
+  Entry&
+  insert(Key key, const TimerWheel::EventId& eventId, time::steady_clock::TimePoint expiry);
+
+  /** \brief record a Data that is not going to be rebroadcast
+   *
+   *  The record only serves to recognize further copies of the Data until \p expiry.
+   */
+  Entry&
+  insert(Key key, time::steady_clock::TimePoint expiry);
+
+  /** \brief cancel the pending rebroadcast of \p key
+   *  \retval true a pending timer was cancelled
+   *  \retval false there was no pending timer
+   */
+  bool
+  cancel(Key key);
+
+  /** \brief release the event of \p key after the rebroadcast timer has fired
+   */
+  void
+  markFired(Key key);
+
+  /** \brief erase the record of \p key, cancelling its timer if it is pending
+   */
+  void
+  erase(Key key);
+
+  /** \brief erase records whose expiry has passed
+   */
+  void
+  evictExpired();
+
+  /** \return number of records, including settled records that are not yet expired
+   */
+  size_t
+  size() const
+  {
+    return m_table.size();
+  }
+
+  /** \return number of records with a scheduled rebroadcast timer
+   */
+  size_t
+  getNPending() const
+  {
+    return m_nPending;
+  }
+
+private:
+  void
+  settle(Entry& entry);
+
+private:
+  using ExpiryRecord = std::pair<time::steady_clock::TimePoint, Key>;
+
+  std::unordered_map<Key, Entry> m_table;
+  std::priority_queue<ExpiryRecord, std::vector<ExpiryRecord>, std::greater<ExpiryRecord>> m_expiryQueue;
+  size_t m_nPending = 0;
+};
+
+/** \brief a packet tag that caches the PendingRebroadcastTable key of a Data
+ */
+using PendingRebroadcastKeyTag = ndn::SimpleTag<PendingRebroadcastTable::Key, 0x60000101>;
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PENDING_REBROADCAST_TABLE_HPP
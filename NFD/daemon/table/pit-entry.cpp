@@ -56,7 +56,7 @@ Entry::getInRecord(const Face& face)
 }
 
 InRecordCollection::iterator
-Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
+Entry::insertOrUpdateInRecord(Face& face, const Interest& interest, EndpointId endpoint)
 {
   BOOST_ASSERT(this->canMatch(interest));
 
@@ -67,7 +67,7 @@ Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
     it = m_inRecords.begin();
   }
 
-  it->update(interest);
+  it->update(interest, endpoint);
   return it;
 }
 
@@ -28,6 +28,7 @@
 
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
+#include "common/timer-wheel.hpp"
 
 #include <list>
 
@@ -138,10 +139,11 @@ public: // in-record
   getInRecord(const Face& face);
 
   /** \brief insert or update an in-record
+   *  \param endpoint the endpoint on \p face from which \p interest was received
    *  \return an iterator to the new or updated in-record
    */
   InRecordCollection::iterator
-  insertOrUpdateInRecord(Face& face, const Interest& interest);
+  insertOrUpdateInRecord(Face& face, const Interest& interest, EndpointId endpoint = 0);
 
   /** \brief delete the in-record for \p face if it exists
    */
@@ -218,9 +220,12 @@ public: // out-record
 public:
   /** \brief Expiry timer
    *
-   *  This timer is used in forwarding pipelines to delete the entry
+   *  This timer is used in forwarding pipelines to delete the entry, when the Interest expires or,
+   *  once the entry is satisfied, when the strategy no longer collects straggler Data; it is the
+   *  only timer of a PIT entry, as it replaced the straggler timer.
+   *  It is scheduled on the TimerWheel of the forwarder that owns the PIT.
    */
-  scheduler::EventId expiryTimer;
+  TimerWheel::EventId expiryTimer;
 
   /** \brief Indicates whether this PIT entry is satisfied
    */
@@ -29,9 +29,11 @@ namespace nfd {
 namespace pit {
 
 void
-InRecord::update(const Interest& interest)
+InRecord::update(const Interest& interest, EndpointId endpoint)
 {
   FaceRecord::update(interest);
+  // Data can be sent to a single endpoint only if every Interest came from that endpoint
+  m_endpoint = m_interest == nullptr || m_endpoint == endpoint ? endpoint : 0;
   m_interest = interest.shared_from_this();
 }
 
@@ -45,11 +45,21 @@ public:
     return *m_interest;
   }
 
+  /** \brief Returns the endpoint from which the Interest was received
+   *  \retval 0 the Interest was received from several endpoints, or the face has no endpoints
+   */
+  EndpointId
+  getEndpoint() const
+  {
+    return m_endpoint;
+  }
+
   void
-  update(const Interest& interest);
+  update(const Interest& interest, EndpointId endpoint = 0);
 
 private:
   shared_ptr<const Interest> m_interest;
+  EndpointId m_endpoint = 0;
 };
 
 } // namespace pit
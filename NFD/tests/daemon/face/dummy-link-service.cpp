@@ -39,7 +39,7 @@ DummyLinkService::doSendInterest(const Interest& interest, const EndpointId&)
 }
 
 void
-DummyLinkService::doSendData(const Data& data, const EndpointId&)
+DummyLinkService::doSendData(const Data& data, const EndpointId&, const EgressFields&)
 {
   if (m_loggingFlags & LogSentData)
     sentData.push_back(data);
@@ -76,7 +76,7 @@ private:
   doSendInterest(const Interest& interest, const EndpointId& endpoint) final;
 
   void
-  doSendData(const Data& data, const EndpointId& endpoint) final;
+  doSendData(const Data& data, const EndpointId& endpoint, const EgressFields& fields) final;
 
   void
   doSendNack(const lp::Nack& nack, const EndpointId& endpoint) final;
@@ -73,7 +73,7 @@ private:
   }
 
   void
-  doSendData(const Data&, const EndpointId&) final
+  doSendData(const Data&, const EndpointId&, const EgressFields&) final
   {
     BOOST_FAIL("unexpected doSendData");
   }
@@ -74,20 +74,7 @@ void
 ConsumerZipfMandelbrot::SetNumberOfContents(uint32_t numOfContents)
 {
   m_N = numOfContents;
-
-  NS_LOG_DEBUG(m_q << " and " << m_s << " and " << m_N);
-
-  m_Pcum = std::vector<double>(m_N + 1);
-
-  m_Pcum[0] = 0.0;
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i - 1] + 1.0 / std::pow(i + m_q, m_s);
-  }
-
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i] / m_Pcum[m_N];
-    NS_LOG_LOGIC("Cumulative probability [" << i << "]=" << m_Pcum[i]);
-  }
+  m_sampler.reset();
 }
 
 uint32_t
@@ -100,7 +87,7 @@ void
 ConsumerZipfMandelbrot::SetQ(double q)
 {
   m_q = q;
-  SetNumberOfContents(m_N);
+  m_sampler.reset();
 }
 
 double
@@ -113,7 +100,7 @@ void
 ConsumerZipfMandelbrot::SetS(double s)
 {
   m_s = s;
-  SetNumberOfContents(m_N);
+  m_sampler.reset();
 }
 
 double
@@ -176,18 +163,7 @@ ConsumerZipfMandelbrot::SendPacket()
 
   // NS_LOG_INFO ("Requesting Interest: \n" << *interest);
   NS_LOG_INFO("> Interest for " << seq << ", Total: " << m_seq << ", face: " << m_face->getId());
-  NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
-
-  m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqLastDelay.erase(seq);
-  m_seqLastDelay.insert(SeqTimeout(seq, Simulator::Now()));
-
-  m_seqRetxCounts[seq]++;
-
-  m_rtt->SentSeq(SequenceNumber32(seq), 1);
+  WillSendOutInterest(seq);
 
   m_transmittedInterests(interest, this, m_face);
   m_appLink->onReceiveInterest(*interest);
@@ -198,24 +174,14 @@ ConsumerZipfMandelbrot::SendPacket()
 uint32_t
 ConsumerZipfMandelbrot::GetNextSeq()
 {
-  uint32_t content_index = 1; //[1, m_N]
-  double p_sum = 0;
+  if (m_sampler == nullptr) {
+    NS_LOG_DEBUG(m_q << " and " << m_s << " and " << m_N);
+    m_sampler = ZipfMandelbrotSampler::get(m_N, m_q, m_s);
+  }
 
   double p_random = m_seqRng->GetValue();
-  while (p_random == 0) {
-    p_random = m_seqRng->GetValue();
-  }
-  // if (p_random == 0)
   NS_LOG_LOGIC("p_random=" << p_random);
-  for (uint32_t i = 1; i <= m_N; i++) {
-    p_sum = m_Pcum[i]; // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1],
-                       // p_cum[2] = p[1] + p[2]
-    if (p_random <= p_sum) {
-      content_index = i;
-      break;
-    } // if
-  }   // for
-  // content_index = 1;
+  uint32_t content_index = m_sampler->sample(p_random); //[1, m_N]
   NS_LOG_DEBUG("RandomNumber=" << content_index);
   return content_index;
 }
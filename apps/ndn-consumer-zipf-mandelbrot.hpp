@@ -26,6 +26,7 @@
 
 #include "ndn-consumer.hpp"
 #include "ndn-consumer-cbr.hpp"
+#include "ns3/ndnSIM/utils/ndn-zipf-mandelbrot-sampler.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/log.h"
@@ -47,6 +48,9 @@ namespace ndn {
  * The class implements an app which requests contents following Zipf-Mandelbrot Distribution
  * Here is the explaination of Zipf-Mandelbrot Distribution:
  *http://en.wikipedia.org/wiki/Zipf%E2%80%93Mandelbrot_law
+ *
+ * Contents are drawn in constant time from a ZipfMandelbrotSampler, built on the first
+ * Interest and shared by all consumers with the same NumberOfContents, q, and s.
  */
 class ConsumerZipfMandelbrot : public ConsumerCbr {
 public:
@@ -94,7 +98,7 @@ private:
   uint32_t m_N;               // number of the contents
   double m_q;                 // q in (k+q)^s
   double m_s;                 // s in (k+q)^s
-  std::vector<double> m_Pcum; // cumulative probability
+  shared_ptr<const ZipfMandelbrotSampler> m_sampler; // built on first use
 
   Ptr<UniformRandomVariable> m_seqRng; // RNG
 };
@@ -31,6 +31,11 @@
 #include <ndn-cxx/lp/tags.hpp>
 #include "utils/ndn-ns3-packet-tag.hpp"
 #include "utils/ndn-rtt-mean-deviation.hpp"
+#include "utils/tracers/ndn-denm-trace.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-position-cache.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pending-rebroadcast-table.hpp"
 #include <ns3/node-list.h>
 #include <ns3/node.h>
 #include <ndn-cxx/lp/tags.hpp>
@@ -93,13 +98,10 @@ void
 Consumer::SetRetxTimer(Time retxTimer)
 {
   m_retxTimer = retxTimer;
-  if (m_retxEvent.IsRunning()) {
-    // m_retxEvent.Cancel (); // cancel any scheduled cleanup events
-    Simulator::Remove(m_retxEvent); // slower, but better for memory
-  }
 
-  // schedule even with new timeout
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  // reschedule any pending check for the new period
+  m_retxEvent.Cancel();
+  ScheduleRetxCheck();
 }
 
 Time
@@ -116,20 +118,44 @@ Consumer::CheckRetxTimeout()
   Time rto = m_rtt->RetransmitTimeout();
   // NS_LOG_DEBUG ("Current RTO: " << rto.ToDouble (Time::S) << "s");
 
-  while (!m_seqTimeouts.empty()) {
-    SeqTimeoutsContainer::index<i_timestamp>::type::iterator entry =
-      m_seqTimeouts.get<i_timestamp>().begin();
-    if (entry->time + rto <= now) // timeout expired?
+  const OutstandingInterestTable::Entry* entry;
+  while ((entry = m_outstanding.getEarliestArmed()) != nullptr) {
+    if (entry->armedAt + rto <= now) // timeout expired?
     {
-      uint32_t seqNo = entry->seq;
-      m_seqTimeouts.get<i_timestamp>().erase(entry);
+      uint32_t seqNo = m_outstanding.disarmEarliest();
       OnTimeout(seqNo);
     }
     else
       break; // nothing else to do. All later packets need not be retransmitted
   }
 
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &Consumer::CheckRetxTimeout, this);
+  ScheduleRetxCheck();
+}
+
+void
+Consumer::ScheduleRetxCheck()
+{
+  const OutstandingInterestTable::Entry* earliest = m_outstanding.getEarliestArmed();
+  if (earliest == nullptr) {
+    m_retxEvent.Cancel();
+    return;
+  }
+
+  Time now = Simulator::Now();
+  Time deadline = earliest->armedAt + m_rtt->RetransmitTimeout();
+  if (m_retxTimer > Time(0)) {
+    int64_t period = m_retxTimer.GetTimeStep();
+    deadline = TimeStep((deadline.GetTimeStep() + period - 1) / period * period);
+  }
+  deadline = std::max(deadline, now);
+
+  if (m_retxEvent.IsRunning() && m_retxCheckTime <= deadline) {
+    return; // an earlier check will reschedule itself
+  }
+
+  m_retxEvent.Cancel();
+  m_retxCheckTime = deadline;
+  m_retxEvent = Simulator::Schedule(deadline - now, &Consumer::CheckRetxTimeout, this);
 }
 
 // Application Methods
@@ -151,6 +177,7 @@ Consumer::StopApplication() // Called at time specified by Stop
 
   // cancel periodic packet generation
   Simulator::Cancel(m_sendEvent);
+  Simulator::Cancel(m_retxEvent);
 
   // cleanup base stuff
   App::StopApplication();
@@ -218,23 +245,17 @@ Consumer::OnData(shared_ptr<const Data> data)
 
   NS_LOG_FUNCTION(this << data);
 
-//Atif-Code: getting geo tag
- std::shared_ptr<lp::GeoTag> tag = data->getTag<lp::GeoTag>();
- 
-if(tag == nullptr){
-    std::cout<<"My Custom Tag value is: null"<<std::endl;
-}
-else{
-  std::tuple<double, double, double> location=tag->getPos();
-  std::cout<<"ndn.consumer onData()  Node-Id: "<<GetCurrentNode()->GetId()<<std::endl;
-  std::cout<<"ndn.consumer onData()  InterestName: "<<data->getName().toUri()<<std::endl;
-  std::cout<<"ndn.consumer onData()  Geo tag x location: "<<std::get<0>(location)<<std::endl;
-  std::cout<<"ndn.consumer onData()  Geo tag y location: "<<std::get<1>(location)<<std::endl;
-  std::cout<<"ndn.consumer onData()  Geo tag z location: "<<std::get<2>(location)<<std::endl;
-}
-//Atif-Code: getting geo tag end
-
-
+  if (DenmTrace::IsEnabled(DenmTrace::Decision::CONSUMED)) {
+    auto denmTag = ::nfd::fw::getDenmName(*data);
+    if (denmTag != nullptr) {
+      const ::nfd::fw::DenmName& denm = denmTag->get();
+      Vector self = L3Protocol::getL3Protocol(GetNode())->getPositionCache().getPosition();
+      double distance = CalculateDistance(Vector(denm.eventX, denm.eventY, 0.0),
+                                          Vector(self.x, self.y, 0.0));
+      DenmTrace::Record(GetNode()->GetId(), DenmTrace::Decision::CONSUMED,
+                        ::nfd::PendingRebroadcastTable::computeKey(data->getName()), distance);
+    }
+  }
 
   // NS_LOG_INFO ("Received content object: " << boost::cref(*data));
 
@@ -249,24 +270,20 @@ else{
   }
   NS_LOG_DEBUG("Hop count: " << hopCount);
 
-  SeqTimeoutsContainer::iterator entry = m_seqLastDelay.find(seq);
-  if (entry != m_seqLastDelay.end()) {
-    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->time, hopCount);
+  const OutstandingInterestTable::Entry* entry = m_outstanding.find(seq);
+  if (entry != nullptr) {
+    m_lastRetransmittedInterestDataDelay(this, seq, Simulator::Now() - entry->lastSent, hopCount);
+    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->firstSent, entry->nTransmissions,
+                             hopCount);
+    m_outstanding.erase(seq);
   }
 
-  entry = m_seqFullDelay.find(seq);
-  if (entry != m_seqFullDelay.end()) {
-    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->time, m_seqRetxCounts[seq], hopCount);
-  }
-
-  m_seqRetxCounts.erase(seq);
-  m_seqFullDelay.erase(seq);
-  m_seqLastDelay.erase(seq);
-
-  m_seqTimeouts.erase(seq);
   m_retxSeqs.erase(seq);
 
   m_rtt->AckSeq(SequenceNumber32(seq));
+
+  // the RTO may have shrunk, or nothing may be left to time out
+  ScheduleRetxCheck();
 }
 
 ns3::Ptr<ns3::Node> 
@@ -308,17 +325,13 @@ void
 Consumer::WillSendOutInterest(uint32_t sequenceNumber)
 {
   NS_LOG_DEBUG("Trying to add " << sequenceNumber << " with " << Simulator::Now() << ". already "
-                                << m_seqTimeouts.size() << " items");
+                                << m_outstanding.size() << " items");
 
-  m_seqTimeouts.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-  m_seqFullDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-
-  m_seqLastDelay.erase(sequenceNumber);
-  m_seqLastDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
-
-  m_seqRetxCounts[sequenceNumber]++;
+  m_outstanding.transmit(sequenceNumber, Simulator::Now());
 
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
+
+  ScheduleRetxCheck();
 }
 
 } // namespace ndn
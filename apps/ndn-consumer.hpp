@@ -30,14 +30,9 @@
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/utils/ndn-rtt-estimator.hpp"
+#include "ns3/ndnSIM/utils/ndn-outstanding-interest-table.hpp"
 
 #include <set>
-#include <map>
-
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/tag.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/member.hpp>
 
 namespace ns3 {
 namespace ndn {
@@ -117,6 +112,16 @@ protected:
   void
   CheckRetxTimeout();
 
+  /**
+   * \brief Schedules CheckRetxTimeout for the earliest retransmission deadline, if any
+   *
+   * The check is rounded up to the next multiple of the retransmission timer, so Interests that
+   * expire within the same period are handled by one event. Nothing is scheduled while no
+   * Interest is awaiting its retransmission timeout.
+   */
+  void
+  ScheduleRetxCheck();
+
   /**
    * \brief Modifies the frequency of checking the retransmission timeouts
    * \param retxTimer Timeout defining how frequent retransmission timeouts should be checked
@@ -142,6 +147,7 @@ protected:
   EventId m_sendEvent; ///< @brief EventId of pending "send packet" event
   Time m_retxTimer;    ///< @brief Currently estimated retransmission timer
   EventId m_retxEvent; ///< @brief Event to check whether or not retransmission should be performed
+  Time m_retxCheckTime; ///< @brief Time for which m_retxEvent is scheduled
 
   Ptr<RttEstimator> m_rtt; ///< @brief RTT estimator
 
@@ -158,54 +164,7 @@ protected:
 
   RetxSeqsContainer m_retxSeqs; ///< \brief ordered set of sequence numbers to be retransmitted
 
-  /**
-   * \struct This struct contains a pair of packet sequence number and its timeout
-   */
-  struct SeqTimeout {
-    SeqTimeout(uint32_t _seq, Time _time)
-      : seq(_seq)
-      , time(_time)
-    {
-    }
-
-    uint32_t seq;
-    Time time;
-  };
-  /// @endcond
-
-  /// @cond include_hidden
-  class i_seq {
-  };
-  class i_timestamp {
-  };
-  /// @endcond
-
-  /// @cond include_hidden
-  /**
-   * \struct This struct contains a multi-index for the set of SeqTimeout structs
-   */
-  struct SeqTimeoutsContainer
-    : public boost::multi_index::
-        multi_index_container<SeqTimeout,
-                              boost::multi_index::
-                                indexed_by<boost::multi_index::
-                                             ordered_unique<boost::multi_index::tag<i_seq>,
-                                                            boost::multi_index::
-                                                              member<SeqTimeout, uint32_t,
-                                                                     &SeqTimeout::seq>>,
-                                           boost::multi_index::
-                                             ordered_non_unique<boost::multi_index::
-                                                                  tag<i_timestamp>,
-                                                                boost::multi_index::
-                                                                  member<SeqTimeout, Time,
-                                                                         &SeqTimeout::time>>>> {
-  };
-
-  SeqTimeoutsContainer m_seqTimeouts; ///< \brief multi-index for the set of SeqTimeout structs
-
-  SeqTimeoutsContainer m_seqLastDelay;
-  SeqTimeoutsContainer m_seqFullDelay;
-  std::map<uint32_t, uint32_t> m_seqRetxCounts;
+  OutstandingInterestTable m_outstanding; ///< \brief Interests awaiting Data, with their timers
 
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */, int32_t /*hop count*/>
     m_lastRetransmittedInterestDataDelay;
@@ -0,0 +1,452 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-denm-producer.hpp"
+#include "ns3/log.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/simulator.h"
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-position-cache.hpp"
+#include "utils/ndn-data-template.hpp"
+#include "utils/tracers/ndn-denm-trace.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/denm-scope-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pending-rebroadcast-table.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+
+NS_LOG_COMPONENT_DEFINE("ndn.DenmProducer");
+
+namespace ns3 {
+namespace ndn {
+
+namespace {
+
+/**
+ * @brief Draw the types of an event located at the producer
+ */
+void
+DrawTypes(UniformRandomVariable& rng, DenmEventProcess::Event& event)
+{
+  event.hasLocation = false;
+  event.appType = rng.GetInteger(0, ::nfd::DenmScopeTable::N_APP_TYPES - 1);
+  event.contentType = rng.GetInteger(0, ::nfd::DenmScopeTable::N_CONTENT_TYPES - 1);
+  event.duration = Time(0);
+}
+
+class PoissonProcess : public DenmEventProcess {
+public:
+  PoissonProcess(double rate, Ptr<ExponentialRandomVariable> arrivalRng,
+                 Ptr<UniformRandomVariable> typeRng)
+    : m_rate(rate)
+    , m_arrivalRng(arrivalRng)
+    , m_typeRng(typeRng)
+  {
+  }
+
+  bool
+  Next(Time now, Event& event) override
+  {
+    if (m_rate <= 0.0) {
+      return false;
+    }
+    event.time = now + Seconds(m_arrivalRng->GetValue(1.0 / m_rate, 0.0));
+    DrawTypes(*m_typeRng, event);
+    return true;
+  }
+
+private:
+  double m_rate;
+  Ptr<ExponentialRandomVariable> m_arrivalRng;
+  Ptr<UniformRandomVariable> m_typeRng;
+};
+
+class MmppProcess : public DenmEventProcess {
+public:
+  MmppProcess(double calmRate, double burstRate, Time meanCalmTime, Time meanBurstTime,
+              Ptr<ExponentialRandomVariable> arrivalRng, Ptr<ExponentialRandomVariable> sojournRng,
+              Ptr<UniformRandomVariable> typeRng)
+    : m_rates{calmRate, burstRate}
+    , m_meanSojournTimes{meanCalmTime, meanBurstTime}
+    , m_arrivalRng(arrivalRng)
+    , m_sojournRng(sojournRng)
+    , m_typeRng(typeRng)
+  {
+    if (meanCalmTime <= Time(0) || meanBurstTime <= Time(0)) {
+      NS_FATAL_ERROR("MMPP sojourn times must be positive");
+    }
+  }
+
+  bool
+  Next(Time now, Event& event) override
+  {
+    if (m_rates[0] <= 0.0 && m_rates[1] <= 0.0) {
+      return false;
+    }
+    if (!m_hasStarted) {
+      m_switchTime = now + DrawSojournTime();
+      m_hasStarted = true;
+    }
+
+    // arrivals are memoryless, so an arrival drawn beyond the state switch is discarded
+    // and drawn again from the switch with the rate of the next state
+    Time t = now;
+    while (true) {
+      double rate = m_rates[m_state];
+      if (rate > 0.0) {
+        Time arrival = t + Seconds(m_arrivalRng->GetValue(1.0 / rate, 0.0));
+        if (arrival < m_switchTime) {
+          event.time = arrival;
+          DrawTypes(*m_typeRng, event);
+          return true;
+        }
+      }
+      t = m_switchTime;
+      m_state = 1 - m_state;
+      m_switchTime = t + DrawSojournTime();
+    }
+  }
+
+private:
+  Time
+  DrawSojournTime()
+  {
+    return Seconds(m_sojournRng->GetValue(m_meanSojournTimes[m_state].GetSeconds(), 0.0));
+  }
+
+private:
+  double m_rates[2];
+  Time m_meanSojournTimes[2];
+  Ptr<ExponentialRandomVariable> m_arrivalRng;
+  Ptr<ExponentialRandomVariable> m_sojournRng;
+  Ptr<UniformRandomVariable> m_typeRng;
+
+  size_t m_state = 0; // 0 is calm, 1 is burst
+  bool m_hasStarted = false;
+  Time m_switchTime;
+};
+
+class TraceProcess : public DenmEventProcess {
+public:
+  explicit
+  TraceProcess(const std::string& fileName)
+  {
+    std::ifstream file(fileName.c_str());
+    if (!file.is_open()) {
+      NS_FATAL_ERROR("Trace file " << fileName << " cannot be opened for reading");
+    }
+
+    std::string line;
+    for (size_t lineNo = 1; std::getline(file, line); ++lineNo) {
+      boost::algorithm::trim(line);
+      if (line.empty() || line[0] == '#') {
+        continue;
+      }
+
+      std::vector<std::string> fields;
+      std::istringstream is(line);
+      for (std::string field; std::getline(is, field, ',');) {
+        fields.push_back(boost::algorithm::trim_copy(field));
+      }
+
+      Event event;
+      try {
+        if (fields.size() < 5) {
+          throw boost::bad_lexical_cast();
+        }
+        event.time = Seconds(boost::lexical_cast<double>(fields[0]));
+        event.hasLocation = true;
+        event.location = Vector(boost::lexical_cast<double>(fields[1]),
+                                boost::lexical_cast<double>(fields[2]), 0.0);
+        event.appType = boost::lexical_cast<uint32_t>(fields[3]);
+        event.contentType = boost::lexical_cast<uint32_t>(fields[4]);
+        event.duration = fields.size() > 5 ? Seconds(boost::lexical_cast<double>(fields[5])) : Time(0);
+      }
+      catch (const boost::bad_lexical_cast&) {
+        if (m_events.empty() && lineNo == 1) {
+          continue; // header
+        }
+        NS_FATAL_ERROR("Malformed event at " << fileName << ":" << lineNo << ": " << line);
+      }
+      // a type outside the DenmScopeTable has no scope, and its DENM name could not be decoded
+      if (event.appType >= ::nfd::DenmScopeTable::N_APP_TYPES ||
+          event.contentType >= ::nfd::DenmScopeTable::N_CONTENT_TYPES) {
+        NS_FATAL_ERROR("Malformed event at " << fileName << ":" << lineNo << ": " << line);
+      }
+      m_events.push_back(event);
+    }
+
+    std::stable_sort(m_events.begin(), m_events.end(),
+                     [] (const Event& a, const Event& b) { return a.time < b.time; });
+  }
+
+  bool
+  Next(Time now, Event& event) override
+  {
+    while (m_next < m_events.size() && m_events[m_next].time < now) {
+      ++m_next;
+    }
+    if (m_next == m_events.size()) {
+      return false;
+    }
+    event = m_events[m_next++];
+    return true;
+  }
+
+private:
+  std::vector<Event> m_events;
+  size_t m_next = 0;
+};
+
+} // namespace
+
+NS_OBJECT_ENSURE_REGISTERED(DenmProducer);
+
+TypeId
+DenmProducer::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::DenmProducer")
+      .SetGroupName("Ndn")
+      .SetParent<App>()
+      .AddConstructor<DenmProducer>()
+      .AddAttribute("Process", "Event arrival process: poisson (default), mmpp, trace",
+                    StringValue("poisson"),
+                    MakeStringAccessor(&DenmProducer::SetProcess, &DenmProducer::GetProcess),
+                    MakeStringChecker())
+      .AddAttribute("EventRate", "Events per second (poisson), or in the calm state (mmpp)",
+                    DoubleValue(0.1), MakeDoubleAccessor(&DenmProducer::m_eventRate),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("BurstRate", "Events per second in the burst state (mmpp)", DoubleValue(1.0),
+                    MakeDoubleAccessor(&DenmProducer::m_burstRate), MakeDoubleChecker<double>(0.0))
+      .AddAttribute("MeanCalmTime", "Mean time spent in the calm state (mmpp)",
+                    TimeValue(Seconds(60)), MakeTimeAccessor(&DenmProducer::m_meanCalmTime),
+                    MakeTimeChecker())
+      .AddAttribute("MeanBurstTime", "Mean time spent in the burst state (mmpp)",
+                    TimeValue(Seconds(10)), MakeTimeAccessor(&DenmProducer::m_meanBurstTime),
+                    MakeTimeChecker())
+      .AddAttribute("TraceFile", "CSV file of the events to replay (trace)", StringValue(""),
+                    MakeStringAccessor(&DenmProducer::m_traceFile), MakeStringChecker())
+      .AddAttribute("RepetitionInterval", "Interval between the DENMs of an active event",
+                    TimeValue(MilliSeconds(100)),
+                    MakeTimeAccessor(&DenmProducer::m_repetitionInterval), MakeTimeChecker())
+      .AddAttribute("EventDuration", "Time an event stays active, unless set by the trace",
+                    TimeValue(Seconds(10)), MakeTimeAccessor(&DenmProducer::m_eventDuration),
+                    MakeTimeChecker())
+      .AddAttribute("MaxEvents", "Maximum number of concurrently active events", UintegerValue(16),
+                    MakeUintegerAccessor(&DenmProducer::m_maxEvents),
+                    MakeUintegerChecker<uint32_t>(1))
+      .AddAttribute("PayloadSize", "Virtual payload size of DENMs", UintegerValue(100),
+                    MakeUintegerAccessor(&DenmProducer::m_virtualPayloadSize),
+                    MakeUintegerChecker<uint32_t>())
+      .AddAttribute("Freshness", "Freshness of DENMs, if 0, then unlimited freshness",
+                    TimeValue(Seconds(0)), MakeTimeAccessor(&DenmProducer::m_freshness),
+                    MakeTimeChecker());
+  return tid;
+}
+
+DenmProducer::DenmProducer()
+  : m_processType("poisson")
+  , m_arrivalRng(CreateObject<ExponentialRandomVariable>())
+  , m_sojournRng(CreateObject<ExponentialRandomVariable>())
+  , m_typeRng(CreateObject<UniformRandomVariable>())
+  , m_nDroppedEvents(0)
+  , m_positionCache(nullptr)
+{
+  NS_LOG_FUNCTION_NOARGS();
+}
+
+DenmProducer::~DenmProducer() = default;
+
+void
+DenmProducer::SetEventProcess(std::unique_ptr<DenmEventProcess> process)
+{
+  m_process = std::move(process);
+  m_processType = "custom";
+}
+
+void
+DenmProducer::SetProcess(const std::string& value)
+{
+  if (value != "poisson" && value != "mmpp" && value != "trace") {
+    NS_FATAL_ERROR("Unknown DENM event process " << value);
+  }
+  m_processType = value;
+  m_process.reset();
+}
+
+std::string
+DenmProducer::GetProcess() const
+{
+  return m_processType;
+}
+
+std::unique_ptr<DenmEventProcess>
+DenmProducer::MakeProcess() const
+{
+  if (m_processType == "mmpp") {
+    return make_unique<MmppProcess>(m_eventRate, m_burstRate, m_meanCalmTime, m_meanBurstTime,
+                                    m_arrivalRng, m_sojournRng, m_typeRng);
+  }
+  if (m_processType == "trace") {
+    return make_unique<TraceProcess>(m_traceFile);
+  }
+  return make_unique<PoissonProcess>(m_eventRate, m_arrivalRng, m_typeRng);
+}
+
+int64_t
+DenmProducer::AssignStreams(int64_t stream)
+{
+  m_arrivalRng->SetStream(stream);
+  m_sojournRng->SetStream(stream + 1);
+  m_typeRng->SetStream(stream + 2);
+  int64_t nStreams = 3;
+  if (m_processType == "custom" && m_process != nullptr) {
+    nStreams += m_process->AssignStreams(stream + nStreams);
+  }
+  return nStreams;
+}
+
+void
+DenmProducer::StartApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+  if (m_repetitionInterval <= Time(0)) {
+    NS_FATAL_ERROR("RepetitionInterval must be positive");
+  }
+  App::StartApplication();
+
+  m_positionCache = &L3Protocol::getL3Protocol(GetNode())->getPositionCache();
+  if (m_processType != "custom") {
+    m_process = MakeProcess();
+  }
+
+  // all per-event state is allocated here, not per DENM
+  m_events.assign(m_maxEvents, ActiveEvent());
+  m_freeEvents.resize(m_maxEvents);
+  for (size_t i = 0; i < m_maxEvents; ++i) {
+    m_freeEvents[i] = m_maxEvents - 1 - i;
+  }
+  m_dataTemplate = make_unique<DataTemplate>(m_virtualPayloadSize);
+
+  ScheduleNextEvent();
+}
+
+void
+DenmProducer::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  Simulator::Cancel(m_eventArrival);
+  for (ActiveEvent& event : m_events) {
+    Simulator::Cancel(event.repetition);
+  }
+
+  App::StopApplication();
+}
+
+void
+DenmProducer::ScheduleNextEvent()
+{
+  if (m_process == nullptr || !m_process->Next(Simulator::Now(), m_nextEvent)) {
+    return;
+  }
+  m_eventArrival = Simulator::Schedule(std::max(m_nextEvent.time - Simulator::Now(), Time(0)),
+                                       &DenmProducer::OnEvent, this);
+}
+
+void
+DenmProducer::OnEvent()
+{
+  if (m_freeEvents.empty()) {
+    ++m_nDroppedEvents;
+    NS_LOG_DEBUG("node(" << GetNode()->GetId() << ") dropping event, " << m_maxEvents
+                 << " events are active");
+  }
+  else {
+    size_t index = m_freeEvents.back();
+    m_freeEvents.pop_back();
+    ActiveEvent& event = m_events[index];
+
+    Vector location = m_nextEvent.hasLocation ? m_nextEvent.location : m_positionCache->getPosition();
+    event.denm = ::nfd::fw::DenmName();
+    event.denm.appType = m_nextEvent.appType;
+    event.denm.contentType = m_nextEvent.contentType;
+    event.denm.eventX = location.x;
+    event.denm.eventY = location.y;
+    event.denm.eventTime = ::ndn::time::duration_cast<::ndn::time::milliseconds>(
+                             ::ndn::time::steady_clock::now().time_since_epoch());
+    event.denm.referenceTime = event.denm.eventTime;
+    event.denm.sequence = 1;
+    event.end = Simulator::Now() +
+                (m_nextEvent.duration > Time(0) ? m_nextEvent.duration : m_eventDuration);
+
+    SendDenm(event.denm);
+    event.repetition = Simulator::Schedule(m_repetitionInterval, &DenmProducer::Repeat, this, index);
+  }
+
+  ScheduleNextEvent();
+}
+
+void
+DenmProducer::Repeat(size_t index)
+{
+  ActiveEvent& event = m_events[index];
+  ++event.denm.sequence;
+  event.denm.referenceTime = ::ndn::time::duration_cast<::ndn::time::milliseconds>(
+                               ::ndn::time::steady_clock::now().time_since_epoch());
+
+  if (Simulator::Now() >= event.end) {
+    event.denm.isTermination = true;
+    SendDenm(event.denm);
+    m_freeEvents.push_back(index);
+    return;
+  }
+
+  SendDenm(event.denm);
+  event.repetition = Simulator::Schedule(m_repetitionInterval, &DenmProducer::Repeat, this, index);
+}
+
+void
+DenmProducer::SendDenm(const ::nfd::fw::DenmName& denm)
+{
+  if (!m_active) {
+    return;
+  }
+
+  auto data = m_dataTemplate->makeData(denm.toName(),
+                                       ::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
+
+  NS_LOG_DEBUG("node(" << GetNode()->GetId() << ") producing DENM: " << data->getName());
+  if (DenmTrace::IsEnabled(DenmTrace::Decision::PRODUCED)) {
+    DenmTrace::Record(GetNode()->GetId(), DenmTrace::Decision::PRODUCED,
+                      ::nfd::PendingRebroadcastTable::computeKey(data->getName()), 0.0);
+  }
+
+  m_transmittedDatas(data, this, m_face);
+  m_appLink->onReceiveData(*data);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_DENM_PRODUCER_H
+#define NDN_DENM_PRODUCER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-app.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/vector.h"
+
+namespace ns3 {
+namespace ndn {
+
+class DataTemplate;
+class PositionCache;
+
+/**
+ * @ingroup ndn-apps
+ * @brief Arrival process of the hazard events detected by a DenmProducer
+ *
+ * A process is asked for its next event every time the previous one has been detected.
+ * Implementations must draw random numbers from streams they own, created once, so that
+ * runs are reproducible with DenmProducer::AssignStreams.
+ */
+class DenmEventProcess {
+public:
+  struct Event
+  {
+    Time time;             ///< absolute simulation time at which the event is detected
+    bool hasLocation;      ///< if false, the event is located at the producer
+    Vector location;
+    uint32_t appType;
+    uint32_t contentType;
+    Time duration;         ///< if zero, the EventDuration of the producer applies
+  };
+
+  virtual
+  ~DenmEventProcess() = default;
+
+  /**
+   * @brief Get the next event after @p now
+   * @param[out] event the next event
+   * @return false if the process has no more events
+   */
+  virtual bool
+  Next(Time now, Event& event) = 0;
+
+  /**
+   * @brief Assign fixed random variable stream numbers, starting at @p stream
+   * @return number of streams assigned
+   */
+  virtual int64_t
+  AssignStreams(int64_t stream)
+  {
+    return 0;
+  }
+};
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pushes DENMs for the hazard events produced by an event process
+ *
+ * Events arrive according to the process selected by the Process attribute:
+ *
+ * - poisson: events at EventRate per second
+ * - mmpp: a two-state Markov-modulated Poisson process, which alternates between a calm
+ *   state with EventRate and a burst state with BurstRate; the sojourn times are exponentially
+ *   distributed with means MeanCalmTime and MeanBurstTime
+ * - trace: events replayed from TraceFile, a CSV file with one event per line:
+ *   @code
+ *   time,x,y,appType,contentType[,duration]
+ *   @endcode
+ *   where time and duration are in seconds and x and y in meters, and appType and contentType
+ *   are within the DenmScopeTable. Empty lines, lines starting with '#', and a header line
+ *   are skipped.
+ *
+ * Poisson and MMPP events are located at the producer, with app and content types drawn
+ * uniformly. Every event is announced by a DENM when it is detected and repeated every
+ * RepetitionInterval until EventDuration has elapsed, when a termination DENM is sent. Each
+ * repetition is an update of the event: it keeps the position and time of the event and
+ * carries the next sequence number, with its own generation time as reference time, so that
+ * it is checked against the temporal range of its scope anew.
+ *
+ * The state of MaxEvents concurrent events is allocated when the application starts and DENMs
+ * are made from a DataTemplate, so a DENM costs a Name, a Data, and its wire encoding.
+ * Events that arrive while MaxEvents events are active are not announced.
+ */
+class DenmProducer : public App {
+public:
+  static TypeId
+  GetTypeId();
+
+  DenmProducer();
+
+  ~DenmProducer();
+
+  /**
+   * @brief Replace the event process with a custom one
+   *
+   * Takes effect at the next start of the application. The Process attribute then reads
+   * "custom" until it is set again.
+   */
+  void
+  SetEventProcess(std::unique_ptr<DenmEventProcess> process);
+
+  /**
+   * @brief Assign fixed random variable stream numbers, starting at @p stream
+   * @return number of streams assigned
+   */
+  int64_t
+  AssignStreams(int64_t stream);
+
+  /**
+   * @brief Get the number of events that were not announced because MaxEvents were active
+   */
+  uint64_t
+  GetNDroppedEvents() const
+  {
+    return m_nDroppedEvents;
+  }
+
+protected:
+  // inherited from Application base class.
+  virtual void
+  StartApplication();
+
+  virtual void
+  StopApplication();
+
+private:
+  struct ActiveEvent
+  {
+    ::nfd::fw::DenmName denm;
+    Time end;
+    EventId repetition;
+  };
+
+  void
+  SetProcess(const std::string& value);
+
+  std::unique_ptr<DenmEventProcess>
+  MakeProcess() const;
+
+  std::string
+  GetProcess() const;
+
+  void
+  ScheduleNextEvent();
+
+  void
+  OnEvent();
+
+  void
+  Repeat(size_t index);
+
+  void
+  SendDenm(const ::nfd::fw::DenmName& denm);
+
+private:
+  std::string m_processType;
+  std::unique_ptr<DenmEventProcess> m_process;
+  DenmEventProcess::Event m_nextEvent;
+  EventId m_eventArrival;
+
+  double m_eventRate;
+  double m_burstRate;
+  Time m_meanCalmTime;
+  Time m_meanBurstTime;
+  std::string m_traceFile;
+
+  Time m_repetitionInterval;
+  Time m_eventDuration;
+  uint32_t m_maxEvents;
+  uint32_t m_virtualPayloadSize;
+  Time m_freshness;
+
+  Ptr<ExponentialRandomVariable> m_arrivalRng;
+  Ptr<ExponentialRandomVariable> m_sojournRng;
+  Ptr<UniformRandomVariable> m_typeRng;
+  std::vector<ActiveEvent> m_events;
+  std::vector<size_t> m_freeEvents;
+  std::unique_ptr<DataTemplate> m_dataTemplate;
+  uint64_t m_nDroppedEvents;
+
+  const PositionCache* m_positionCache;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_DENM_PRODUCER_H
@@ -0,0 +1,244 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-denm-receiver.hpp"
+#include "ns3/log.h"
+#include "ns3/string.h"
+#include "ns3/double.h"
+#include "ns3/simulator.h"
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-position-cache.hpp"
+#include "helper/ndn-fib-helper.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <boost/functional/hash.hpp>
+
+NS_LOG_COMPONENT_DEFINE("ndn.DenmReceiver");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(DenmReceiver);
+
+TypeId
+DenmReceiver::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::DenmReceiver")
+      .SetGroupName("Ndn")
+      .SetParent<App>()
+      .AddConstructor<DenmReceiver>()
+      .AddAttribute("RelevanceRange",
+                    "Distance from the trajectory of the vehicle within which an event is relevant",
+                    DoubleValue(200.0), MakeDoubleAccessor(&DenmReceiver::m_relevanceRange),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("Horizon", "How far ahead the trajectory of the vehicle is extrapolated",
+                    TimeValue(Seconds(30)), MakeTimeAccessor(&DenmReceiver::m_horizon),
+                    MakeTimeChecker())
+      .AddAttribute("EventLifetime", "How long an event is remembered after its last DENM",
+                    TimeValue(Seconds(60)), MakeTimeAccessor(&DenmReceiver::m_eventLifetime),
+                    MakeTimeChecker())
+      .AddAttribute("ReportFile", "CSV file the latency histograms are appended to on stop",
+                    StringValue(""), MakeStringAccessor(&DenmReceiver::m_reportFile),
+                    MakeStringChecker());
+  return tid;
+}
+
+DenmReceiver::DenmReceiver()
+  : m_positionCache(nullptr)
+{
+  NS_LOG_FUNCTION_NOARGS();
+}
+
+void
+DenmReceiver::StartApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+  App::StartApplication();
+
+  m_positionCache = &L3Protocol::getL3Protocol(GetNode())->getPositionCache();
+  m_lastPurge = Simulator::Now();
+
+  Name prefix;
+  prefix.append(::nfd::fw::DenmName::getKeyword());
+  FibHelper::AddRoute(GetNode(), prefix, m_face, 0);
+}
+
+void
+DenmReceiver::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+
+  for (size_t appType = 0; appType < m_latencies.size(); ++appType) {
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") appType=" << appType
+                << " events=" << m_latencies[appType].getCount()
+                << " mean=" << m_latencies[appType].getMean() << "us"
+                << " p50=" << m_latencies[appType].getQuantile(0.5) << "us"
+                << " p99=" << m_latencies[appType].getQuantile(0.99) << "us"
+                << " max=" << m_latencies[appType].getMax() << "us");
+  }
+  WriteReport();
+
+  App::StopApplication();
+}
+
+void
+DenmReceiver::OnData(shared_ptr<const Data> data)
+{
+  App::OnData(data); // tracing inside
+  NS_LOG_FUNCTION(this << data);
+
+  if (!m_active) {
+    return;
+  }
+
+  auto denmTag = ::nfd::fw::getDenmName(*data);
+  if (denmTag == nullptr) {
+    return;
+  }
+  const ::nfd::fw::DenmName& denm = denmTag->get();
+  Time now = Simulator::Now();
+  PurgeEvents();
+
+  size_t key = GetEventKey(denm);
+  auto it = m_events.find(key);
+  if (it != m_events.end()) {
+    EventState& event = it->second;
+    if (denm.sequence <= event.lastSequence) {
+      ++m_counters.nDuplicates;
+      return;
+    }
+    event.lastSequence = denm.sequence;
+    event.lastReception = now;
+    ++m_counters.nUpdates;
+    if (denm.isTermination) {
+      ++m_counters.nTerminated;
+    }
+    return;
+  }
+
+  m_events.emplace(key, EventState{denm.sequence, now});
+  ++m_counters.nEvents;
+  if (denm.isTermination) {
+    ++m_counters.nTerminated;
+    return;
+  }
+
+  Vector event(denm.eventX, denm.eventY, 0.0);
+  if (!IsOnTrajectory(m_positionCache->getPosition(), m_positionCache->getVelocity(), event,
+                      m_relevanceRange, m_horizon)) {
+    NS_LOG_DEBUG("node(" << GetNode()->GetId() << ") irrelevant DENM: " << data->getName());
+    return;
+  }
+  ++m_counters.nRelevant;
+
+  auto latency = time::steady_clock::now().time_since_epoch() - denm.eventTime;
+  auto micros = time::duration_cast<time::microseconds>(latency).count();
+  NS_LOG_DEBUG("node(" << GetNode()->GetId() << ") relevant DENM: " << data->getName()
+               << " latency=" << micros << "us");
+  if (denm.appType < m_latencies.size()) {
+    m_latencies[denm.appType].add(static_cast<uint64_t>(std::max<int64_t>(micros, 0)));
+  }
+}
+
+const LogHistogram&
+DenmReceiver::GetLatencyHistogram(uint32_t appType) const
+{
+  return m_latencies.at(appType);
+}
+
+bool
+DenmReceiver::IsOnTrajectory(const Vector& position, const Vector& velocity, const Vector& event,
+                             double range, Time horizon)
+{
+  double wx = position.x - event.x;
+  double wy = position.y - event.y;
+
+  // time of the closest approach to the event, within the horizon
+  double t = 0.0;
+  double speed2 = velocity.x * velocity.x + velocity.y * velocity.y;
+  if (speed2 > 0.0) {
+    t = -(wx * velocity.x + wy * velocity.y) / speed2;
+    t = std::min(std::max(t, 0.0), horizon.GetSeconds());
+  }
+
+  double dx = wx + velocity.x * t;
+  double dy = wy + velocity.y * t;
+  return dx * dx + dy * dy <= range * range;
+}
+
+size_t
+DenmReceiver::GetEventKey(const ::nfd::fw::DenmName& denm)
+{
+  // the sequence number is left out, so that updates map to the same event
+  size_t seed = 0;
+  boost::hash_combine(seed, denm.appType);
+  boost::hash_combine(seed, denm.contentType);
+  boost::hash_combine(seed, denm.eventX);
+  boost::hash_combine(seed, denm.eventY);
+  boost::hash_combine(seed, denm.eventTime.count());
+  return seed;
+}
+
+void
+DenmReceiver::PurgeEvents()
+{
+  Time now = Simulator::Now();
+  if (now - m_lastPurge < m_eventLifetime) {
+    return;
+  }
+  m_lastPurge = now;
+
+  for (auto it = m_events.begin(); it != m_events.end();) {
+    if (now - it->second.lastReception >= m_eventLifetime) {
+      it = m_events.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+void
+DenmReceiver::WriteReport() const
+{
+  if (m_reportFile.empty()) {
+    return;
+  }
+
+  std::ofstream file(m_reportFile.c_str(), std::ios_base::out | std::ios_base::app);
+  if (!file.is_open()) {
+    NS_FATAL_ERROR("File " << m_reportFile << " cannot be opened for writing");
+  }
+  file.seekp(0, std::ios_base::end);
+  if (file.tellp() == 0) {
+    file << "Node,AppType,LowerUs,UpperUs,Count\n";
+  }
+
+  uint32_t nodeId = GetNode()->GetId();
+  for (size_t appType = 0; appType < m_latencies.size(); ++appType) {
+    m_latencies[appType].forEachBucket([&] (uint64_t lower, uint64_t upper, uint64_t count) {
+      file << nodeId << "," << appType << "," << lower << "," << upper << "," << count << "\n";
+    });
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
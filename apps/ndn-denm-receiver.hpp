@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_DENM_RECEIVER_H
+#define NDN_DENM_RECEIVER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ndn-app.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/denm-scope-table.hpp"
+#include "ns3/ndnSIM/utils/ndn-log-histogram.hpp"
+
+#include "ns3/nstime.h"
+
+#include <array>
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+
+class PositionCache;
+
+/**
+ * @ingroup ndn-apps
+ * @brief Models the safety application of a vehicle that consumes DENMs
+ *
+ * The application registers the /denm prefix on its face and receives the DENMs that the
+ * forwarder delivers. A DENM is attributed to its event, identified by the type, position, and
+ * time of the event; copies of a DENM already received are dropped, and a DENM with a higher
+ * sequence number is counted as an update of the event.
+ *
+ * The first DENM of an event is relevant if the trajectory of the vehicle, extrapolated from its
+ * current position and velocity over Horizon, comes within RelevanceRange of the event. The
+ * latency from the event time, when the first DENM was generated, to its reception is then
+ * recorded into a LogHistogram of the app type, in microseconds.
+ *
+ * When the application stops, the histograms are written to ReportFile, if set, as CSV lines:
+ * @code
+ * Node,AppType,LowerUs,UpperUs,Count
+ * @endcode
+ * where each line is a bucket holding latencies in [LowerUs, UpperUs).
+ */
+class DenmReceiver : public App {
+public:
+  static TypeId
+  GetTypeId();
+
+  DenmReceiver();
+
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+  /**
+   * @brief Get the latencies of the relevant events of @p appType, in microseconds
+   */
+  const LogHistogram&
+  GetLatencyHistogram(uint32_t appType) const;
+
+  struct Counters
+  {
+    uint64_t nEvents = 0;     ///< events received
+    uint64_t nRelevant = 0;   ///< events found relevant
+    uint64_t nUpdates = 0;    ///< DENMs updating an event
+    uint64_t nDuplicates = 0; ///< copies of a DENM already received
+    uint64_t nTerminated = 0; ///< events terminated
+  };
+
+  const Counters&
+  GetCounters() const
+  {
+    return m_counters;
+  }
+
+  /**
+   * @brief Determine whether a vehicle at @p position moving at @p velocity comes within
+   *        @p range of @p event within @p horizon
+   */
+  static bool
+  IsOnTrajectory(const Vector& position, const Vector& velocity, const Vector& event,
+                 double range, Time horizon);
+
+protected:
+  // inherited from Application base class.
+  virtual void
+  StartApplication();
+
+  virtual void
+  StopApplication();
+
+private:
+  struct EventState
+  {
+    uint64_t lastSequence;
+    Time lastReception;
+  };
+
+  static size_t
+  GetEventKey(const ::nfd::fw::DenmName& denm);
+
+  /**
+   * @brief Forget events that have not been heard of for EventLifetime
+   */
+  void
+  PurgeEvents();
+
+  void
+  WriteReport() const;
+
+private:
+  double m_relevanceRange;
+  Time m_horizon;
+  Time m_eventLifetime;
+  std::string m_reportFile;
+
+  std::unordered_map<size_t, EventState> m_events;
+  Time m_lastPurge;
+  std::array<LogHistogram, ::nfd::DenmScopeTable::N_APP_TYPES> m_latencies;
+  Counters m_counters;
+
+  const PositionCache* m_positionCache;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_DENM_RECEIVER_H
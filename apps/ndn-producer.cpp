@@ -25,14 +25,16 @@
 #include "ns3/simulator.h"
 #include "ns3/random-variable-stream.h"
 #include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-position-cache.hpp"
 #include "helper/ndn-fib-helper.hpp"
+#include "utils/ndn-data-template.hpp"
+#include "utils/tracers/ndn-denm-trace.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pending-rebroadcast-table.hpp"
 #include <ndn-cxx/lp/tags.hpp>
 #include <memory>
 #include <string.h>
 
-#include <ns3/node-list.h>
-#include <ns3/node.h>
-#include "ns3/mobility-model.h"
 #include "ns3/core-module.h"
 NS_LOG_COMPONENT_DEFINE("ndn.Producer");
 
@@ -79,12 +81,14 @@ Producer::Producer()
   NS_LOG_FUNCTION_NOARGS();
 }
 
+Producer::~Producer() = default;
+
 // inherited from Application base class.
 void
 Producer::StartApplication()
 {
-  // Atif-Code 
-  std::cout<<"ndn.Producer StartApplication(): Producer application has been started"<<std::endl;
+  m_positionCache = &L3Protocol::getL3Protocol(GetNode())->getPositionCache();
+  m_dataTemplate = make_unique<DataTemplate>(m_virtualPayloadSize, m_signature, m_keyLocator);
   ScheduleAdvertisementPacket(true);
   NS_LOG_FUNCTION_NOARGS();
   App::StartApplication();
@@ -126,47 +130,11 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
   if (!m_active)
     return;
 
-  Name dataName(interest->getName());
-
-  auto data = make_shared<Data>();
-  data->setName(dataName);
- // std::cout<<"ndn.Producer onData()  InterestName: "<<data->getName().toUri()<<std::endl;
-  data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
-
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
-
-//Atif-Code:  setting geo tag
-  std::tuple<double,double,double> pos={29.81,71.32,36.123};
-  lp::GeoTag geoTag(pos);
-  data->setTag<lp::GeoTag>(std::make_shared<lp::GeoTag>(geoTag));
-
-
-  std::shared_ptr<lp::GeoTag> tag = data->getTag<lp::GeoTag>();
-  std::tuple<double, double, double> location=tag->getPos();
-  // std::cout<<"ndn.producer onInterest()  Geo tag x location: "<<std::get<0>(location)<<std::endl;
-  // std::cout<<"ndn.producer onInterest()  Geo tag y location: "<<std::get<1>(location)<<std::endl;
-  // std::cout<<"ndn.producer onInterest()  Geo tag z location: "<<std::get<2>(location)<<std::endl;
-  
-//Atif-Code: setting geo tag end 
-
-
-  Signature signature;
-  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
-
-  if (m_keyLocator.size() > 0) {
-    signatureInfo.setKeyLocator(m_keyLocator);
-  }
-
-  signature.setInfo(signatureInfo);
-  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
-
-  data->setSignature(signature);
+  auto data = m_dataTemplate->makeData(interest->getName(),
+                                       ::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
   NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
 
-  // to create real wire encoding
-  data->wireEncode();
-
   m_transmittedDatas(data, this, m_face);
   m_appLink->onReceiveData(*data);
   ScheduleAdvertisementPacket(false);
@@ -191,46 +159,38 @@ Producer::GetDENMDataName(){
   // We have to set content type, application type, current time, current location of producer 
   // application type: 0,1,2,3
   // content type: 0,1,2,3
-  // current in string format
-  // curren location (x,y) in string format
+  // event time and location are encoded as typed components, see nfd::fw::DenmName
 
   Ptr<UniformRandomVariable> m_rand(CreateObject<UniformRandomVariable>());
-  std::string applicationType= std::to_string(std::ceil(m_rand->GetValue(0, 3)));
-  std::string contentType=std::to_string(std::ceil(m_rand->GetValue(0, 3)));
-  std::string currentLocation=CurrentNodeLocation();
-  std::string currentTime= std::to_string(CurrentTime());
+  ::nfd::fw::DenmName denm;
+  denm.appType = static_cast<uint32_t>(std::ceil(m_rand->GetValue(0, 3)));
+  denm.contentType = static_cast<uint32_t>(std::ceil(m_rand->GetValue(0, 3)));
+  Vector currentLocation = CurrentNodeLocation();
+  denm.eventX = currentLocation.x;
+  denm.eventY = currentLocation.y;
+  denm.eventTime = ::ndn::time::milliseconds(CurrentTime());
+  denm.referenceTime = denm.eventTime;
   m_sequence_number=m_sequence_number+1;
-  std::string nameString="/denm/"+applicationType+"/"+contentType+"/"+currentLocation+"/"+currentTime+"/"+ std::to_string(m_sequence_number)+"/";
-  
-  std::cout<<"ndn.Producer GetDENMDataName(): name value: "<<nameString<<std::endl;
+  denm.sequence = m_sequence_number;
 
-  shared_ptr<Name> name = make_shared<Name>(nameString);
+  shared_ptr<Name> name = make_shared<Name>(denm.toName());
+
+  NS_LOG_DEBUG("node(" << GetNode()->GetId() << ") producing DENM: " << *name);
+  if (DenmTrace::IsEnabled(DenmTrace::Decision::PRODUCED)) {
+    DenmTrace::Record(GetNode()->GetId(), DenmTrace::Decision::PRODUCED,
+                      ::nfd::PendingRebroadcastTable::computeKey(*name), 0.0);
+  }
 
   return name;
 }
-std::string
+
+Vector
 Producer::CurrentNodeLocation()
 {
-    std::string currentLocation;
-    if (ns3::Simulator::GetContext() < 1000000) {
-
-        ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(ns3::Simulator::GetContext());
-        uint32_t nodeId = node->GetId();
-        //std::cout<<"ndn.Forwarder getCurrentNodeLocation(): node-id:  "<<nodeId<<std::endl;
-        ns3::Ptr<ns3::MobilityModel> mobility = node->GetObject<ns3::MobilityModel>();
-        if (mobility!=nullptr)
-        {
-          currentLocation = std::to_string(mobility->GetPosition().x)+"-"+std::to_string(mobility->GetPosition().y)
-          +"-"+std::to_string(mobility->GetPosition().z);
-        }
-        else
-        {
-          std::cout<<"ndn.Producer getCurrentNodeLocation(): mobility return nullptr."<<std::endl;
-        }
-   }
-   return currentLocation;
+  return m_positionCache->getPosition();
 }
-int
+
+int64_t
 Producer::CurrentTime()
 {
 ndn::time::steady_clock::TimePoint now = ::ndn::time::steady_clock::now(); 
@@ -27,10 +27,14 @@
 
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
+#include "ns3/vector.h"
 
 namespace ns3 {
 namespace ndn {
 
+class DataTemplate;
+class PositionCache;
+
 /**
  * @ingroup ndn-apps
  * @brief A simple Interest-sink applia simple Interest-sink application
@@ -47,6 +51,8 @@ public:
 
   Producer();
 
+  ~Producer();
+
   // inherited from NdnApp
   virtual void
   OnInterest(shared_ptr<const Interest> interest);
@@ -72,10 +78,10 @@ protected:
   shared_ptr<Name>
   GetDENMDataName();
 
-  std::string
+  Vector
   CurrentNodeLocation();
   
-  int
+  int64_t
   CurrentTime();
 
  // Atif-Code: End 
@@ -90,6 +96,8 @@ private:
   uint32_t m_sequence_number=0;
   Name m_keyLocator;
   double m_adv_transmission_interval;
+  const PositionCache* m_positionCache = nullptr;
+  std::unique_ptr<DataTemplate> m_dataTemplate;
 };
 
 } // namespace ndn
@@ -0,0 +1,73 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <fstream>
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Converts a binary DENM trace, written by ndn::DenmTrace, into comma-separated values:
+ *
+ *     ./waf --run="ndn-denm-trace-to-csv --input=denm-trace.bin --output=denm-trace.csv"
+ *
+ * The CSV is written to the standard output if no output file is given.
+ */
+int
+main(int argc, char* argv[])
+{
+  std::string input = "denm-trace.bin";
+  std::string output;
+
+  CommandLine cmd;
+  cmd.AddValue("input", "Binary DENM trace file", input);
+  cmd.AddValue("output", "CSV file, standard output if empty", output);
+  cmd.Parse(argc, argv);
+
+  std::ofstream file;
+  if (!output.empty()) {
+    file.open(output.c_str(), std::ios_base::out | std::ios_base::trunc);
+    if (!file.is_open()) {
+      std::cerr << "File " << output << " cannot be opened for writing" << std::endl;
+      return 1;
+    }
+  }
+
+  try {
+    size_t nRecords = ndn::DenmTrace::ConvertToCsv(input, output.empty() ? std::cout : file);
+    std::cerr << nRecords << " records converted" << std::endl;
+  }
+  catch (const std::runtime_error& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
@@ -197,6 +197,11 @@ main(int argc, char* argv[])
   cmd.AddValue("_mobileNdesCount", "Total Number of Mobile Nodes: ", _mobileNdesCount);
   cmd.AddValue("_mobileNodesVelocity", "Mobile Nodes Velocity: ", _mobileNodesVelocity);
     cmd.AddValue("_transmissionInterval", "Advertisement Packet Transmission Frequency: ", _transmissionInterval);
+  std::string denmTraceFile;
+  cmd.AddValue("denmTrace", "File for the binary DENM trace, disabled if empty", denmTraceFile);
+  std::string denmTracerFile;
+  cmd.AddValue("denmTracer", "File for per-DENM coverage, latency and redundancy, disabled if empty",
+               denmTracerFile);
   
   cmd.Parse (argc, argv);
 
@@ -230,6 +235,8 @@ main(int argc, char* argv[])
   // 4. Set broadcast strategy
   ndn::StrategyChoiceHelper::Install(mobileNodes, "/", "/localhost/nfd/strategy/broadcast");
     ndn::StrategyChoiceHelper::Install(staticNodes, "/", "/localhost/nfd/strategy/broadcast");
+  ndn::StrategyChoiceHelper::Install(mobileNodes, "/denm", "/localhost/nfd/strategy/denm-geo");
+  ndn::StrategyChoiceHelper::Install(staticNodes, "/denm", "/localhost/nfd/strategy/denm-geo");
 
   // 4. Set up applications
   NS_LOG_INFO("Installing Applications"); 
@@ -248,7 +255,15 @@ main(int argc, char* argv[])
   Simulator::Schedule(Seconds(_revertDirectionTime), &RevertDirection, mobileNodes,false,0);
   Simulator::Stop(Seconds(30.0));
 
+  if (!denmTraceFile.empty()) {
+    ndn::DenmTrace::Open(denmTraceFile, ndn::DenmTrace::LEVEL_DECISION);
+  }
+  if (!denmTracerFile.empty()) {
+    ndn::DenmTracer::InstallAll(denmTracerFile);
+  }
+
   Simulator::Run();
+  ndn::DenmTrace::Close();
   Simulator::Destroy();
 
   return 0;
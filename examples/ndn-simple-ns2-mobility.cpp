@@ -83,6 +83,7 @@ MakeCallback (&CourseChange));
 
   // Set BestRoute strategy
   ndn::StrategyChoiceHelper::Install(nodes, "/", "/localhost/nfd/strategy/best-route");
+  ndn::StrategyChoiceHelper::Install(nodes, "/denm", "/localhost/nfd/strategy/denm-geo");
 
   // 4. Set up applications
   NS_LOG_INFO("Installing Applications"); 
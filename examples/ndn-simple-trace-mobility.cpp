@@ -81,6 +81,7 @@ main(int argc, char* argv[])
 
   // Set BestRoute strategy
   ndn::StrategyChoiceHelper::Install(nodes, "/", "/localhost/nfd/strategy/best-route");
+  ndn::StrategyChoiceHelper::Install(nodes, "/denm", "/localhost/nfd/strategy/denm-geo");
 
   // 4. Set up applications
   NS_LOG_INFO("Installing Applications"); 
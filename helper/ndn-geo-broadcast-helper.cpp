@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-geo-broadcast-helper.hpp"
+
+#include "model/ndn-geo-broadcast-channel.hpp"
+#include "model/ndn-geo-broadcast-net-device.hpp"
+
+#include "ns3/mac48-address.h"
+
+namespace ns3 {
+namespace ndn {
+
+GeoBroadcastHelper::GeoBroadcastHelper()
+{
+  m_channelFactory.SetTypeId(GeoBroadcastChannel::GetTypeId());
+  m_deviceFactory.SetTypeId(GeoBroadcastNetDevice::GetTypeId());
+}
+
+void
+GeoBroadcastHelper::SetChannelAttribute(const std::string& name, const AttributeValue& value)
+{
+  m_channelFactory.Set(name, value);
+}
+
+void
+GeoBroadcastHelper::SetDeviceAttribute(const std::string& name, const AttributeValue& value)
+{
+  m_deviceFactory.Set(name, value);
+}
+
+NetDeviceContainer
+GeoBroadcastHelper::Install(const NodeContainer& nodes) const
+{
+  return Install(nodes, m_channelFactory.Create<GeoBroadcastChannel>());
+}
+
+NetDeviceContainer
+GeoBroadcastHelper::Install(const NodeContainer& nodes, Ptr<GeoBroadcastChannel> channel) const
+{
+  NetDeviceContainer devices;
+  for (auto node = nodes.Begin(); node != nodes.End(); ++node) {
+    Ptr<GeoBroadcastNetDevice> device = m_deviceFactory.Create<GeoBroadcastNetDevice>();
+    device->SetAddress(Mac48Address::Allocate());
+    (*node)->AddDevice(device);
+    device->SetChannel(channel);
+    devices.Add(device);
+  }
+  return devices;
+}
+
+} // namespace ndn
+} // namespace ns3
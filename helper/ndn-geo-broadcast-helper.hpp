@@ -0,0 +1,77 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_GEO_BROADCAST_HELPER_HPP
+#define NDN_GEO_BROADCAST_HELPER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/net-device-container.h"
+#include "ns3/node-container.h"
+#include "ns3/object-factory.h"
+
+namespace ns3 {
+namespace ndn {
+
+class GeoBroadcastChannel;
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to attach nodes to a GeoBroadcastChannel
+ *
+ * The nodes need a MobilityModel before the simulation starts. NDN faces are created on the
+ * installed devices by StackHelper, which should be installed afterwards.
+ */
+class GeoBroadcastHelper {
+public:
+  GeoBroadcastHelper();
+
+  /**
+   * @brief Set an attribute of the channels created by Install
+   */
+  void
+  SetChannelAttribute(const std::string& name, const AttributeValue& value);
+
+  /**
+   * @brief Set an attribute of the devices created by Install
+   */
+  void
+  SetDeviceAttribute(const std::string& name, const AttributeValue& value);
+
+  /**
+   * @brief Install a GeoBroadcastNetDevice on each of @p nodes, attached to a new channel
+   */
+  NetDeviceContainer
+  Install(const NodeContainer& nodes) const;
+
+  /**
+   * @brief Install a GeoBroadcastNetDevice on each of @p nodes, attached to @p channel
+   */
+  NetDeviceContainer
+  Install(const NodeContainer& nodes, Ptr<GeoBroadcastChannel> channel) const;
+
+private:
+  ObjectFactory m_channelFactory;
+  ObjectFactory m_deviceFactory;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_GEO_BROADCAST_HELPER_HPP
@@ -31,6 +31,7 @@
 #include "../../visualizer/model/visual-simulator-impl.h"
 #endif // HAVE_NS3_VISUALIZER
 
+#include "model/ndn-geo-broadcast-net-device.hpp"
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-transport.hpp"
 #include "utils/ndn-time.hpp"
@@ -41,6 +42,7 @@
 #include <boost/lexical_cast.hpp>
 
 #include "ns3/ndnSIM/NFD/daemon/face/generic-link-service.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/cs-policy-geo-temporal.hpp"
 #include "ns3/ndnSIM/NFD/daemon/table/cs-policy-priority-fifo.hpp"
 #include "ns3/ndnSIM/NFD/daemon/table/cs-policy-lru.hpp"
 
@@ -58,6 +60,7 @@ StackHelper::StackHelper()
 
   m_csPolicies.insert({"nfd::cs::lru", [] { return make_unique<nfd::cs::LruPolicy>(); }});
   m_csPolicies.insert({"nfd::cs::priority_fifo", [] () { return make_unique<nfd::cs::PriorityFifoPolicy>(); }});
+  m_csPolicies.insert({"nfd::cs::geo-temporal", [] { return make_unique<nfd::cs::GeoTemporalPolicy>(); }});
 
   m_csPolicyCreationFunc = m_csPolicies["nfd::cs::lru"];
 
@@ -66,6 +69,9 @@ StackHelper::StackHelper()
   m_netDeviceCallbacks.push_back(
     std::make_pair(PointToPointNetDevice::GetTypeId(),
                    MakeCallback(&StackHelper::PointToPointNetDeviceCallback, this)));
+  m_netDeviceCallbacks.push_back(
+    std::make_pair(GeoBroadcastNetDevice::GetTypeId(),
+                   MakeCallback(&StackHelper::GeoBroadcastNetDeviceCallback, this)));
   // default callback will be fired if non of others callbacks fit or did the job
 }
 
@@ -116,6 +122,13 @@ StackHelper::setCsSize(size_t maxSize)
   m_maxCsSize = maxSize;
 }
 
+void
+StackHelper::setLpAggregation(Time holdTime)
+{
+  m_isLpAggregationEnabled = true;
+  m_lpAggregationHoldTime = holdTime;
+}
+
 void
 StackHelper::setPolicy(const std::string& policy)
 {
@@ -132,6 +145,57 @@ StackHelper::setPolicy(const std::string& policy)
   }
 }
 
+static boost::property_tree::ptree
+makeDenmScopeEntry(uint32_t appType, uint32_t contentType, double spatialRange, Time temporalRange)
+{
+  boost::property_tree::ptree scope;
+  scope.put("app_type", appType);
+  scope.put("content_type", contentType);
+  scope.put("spatial_range", spatialRange);
+  scope.put("temporal_range", temporalRange.GetMilliSeconds());
+  return scope;
+}
+
+void
+StackHelper::setDenmScope(double spatialRange, Time temporalRange)
+{
+  m_denmScopeConfig.put("spatial_range", spatialRange);
+  m_denmScopeConfig.put("temporal_range", temporalRange.GetMilliSeconds());
+}
+
+void
+StackHelper::setDenmScope(uint32_t appType, uint32_t contentType, double spatialRange,
+                          Time temporalRange)
+{
+  m_denmScopeConfig.add_child("scope",
+                              makeDenmScopeEntry(appType, contentType, spatialRange, temporalRange));
+}
+
+void
+StackHelper::setDenmScopeRegion(double minX, double minY, double maxX, double maxY,
+                                uint32_t appType, uint32_t contentType, double spatialRange,
+                                Time temporalRange)
+{
+  boost::property_tree::ptree* region = nullptr;
+  for (auto& item : m_denmScopeConfig) {
+    if (item.first == "region" &&
+        item.second.get<double>("min_x") == minX && item.second.get<double>("min_y") == minY &&
+        item.second.get<double>("max_x") == maxX && item.second.get<double>("max_y") == maxY) {
+      region = &item.second;
+      break;
+    }
+  }
+
+  if (region == nullptr) {
+    region = &m_denmScopeConfig.add_child("region", boost::property_tree::ptree());
+    region->put("min_x", minX);
+    region->put("min_y", minY);
+    region->put("max_x", maxX);
+    region->put("max_y", maxY);
+  }
+  region->add_child("scope", makeDenmScopeEntry(appType, contentType, spatialRange, temporalRange));
+}
+
 void
 StackHelper::Install(const NodeContainer& c) const
 {
@@ -174,6 +238,10 @@ StackHelper::doInstall(Ptr<Node> node) const
 
   ndn->getConfig().put("tables.cs_max_packets", m_maxCsSize);
 
+  if (!m_denmScopeConfig.empty()) {
+    ndn->getConfig().put_child("tables.denm_scope", m_denmScopeConfig);
+  }
+
   ndn->setCsReplacementPolicy(m_csPolicyCreationFunc);
 
   // Aggregate L3Protocol on node (must be after setting ndnSIM CS)
@@ -218,6 +286,30 @@ StackHelper::RemoveFaceCreateCallback(TypeId netDeviceType,
     });
 }
 
+void
+StackHelper::SetLinkType(TypeId netDeviceType, ::ndn::nfd::LinkType linkType)
+{
+  m_linkTypes[netDeviceType] = linkType;
+}
+
+bool
+StackHelper::isLpAggregationEnabled(Ptr<NetDevice> netDevice) const
+{
+  // point-to-point links have no MAC contention to save
+  return m_isLpAggregationEnabled && getLinkType(netDevice) == ::ndn::nfd::LINK_TYPE_AD_HOC;
+}
+
+::ndn::nfd::LinkType
+StackHelper::getLinkType(Ptr<NetDevice> netDevice) const
+{
+  auto linkType = m_linkTypes.find(netDevice->GetInstanceTypeId());
+  if (linkType != m_linkTypes.end()) {
+    return linkType->second;
+  }
+  return netDevice->IsPointToPoint() ? ::ndn::nfd::LINK_TYPE_POINT_TO_POINT :
+                                       ::ndn::nfd::LINK_TYPE_AD_HOC;
+}
+
 std::string
 constructFaceUri(Ptr<NetDevice> netDevice)
 {
@@ -242,12 +334,19 @@ StackHelper::DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
   opts.allowFragmentation = true;
   opts.allowReassembly = true;
   opts.allowCongestionMarking = true;
+  if (isLpAggregationEnabled(netDevice)) {
+    opts.allowAggregation = true;
+    opts.aggregationHoldTime = time::nanoseconds(m_lpAggregationHoldTime.GetNanoSeconds());
+  }
 
   auto linkService = make_unique<::nfd::face::GenericLinkService>(opts);
 
   auto transport = make_unique<NetDeviceTransport>(node, netDevice,
                                                    constructFaceUri(netDevice),
-                                                   "netdev://[ff:ff:ff:ff:ff:ff]");
+                                                   "netdev://[ff:ff:ff:ff:ff:ff]",
+                                                   ::ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                                                   ::ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                                                   getLinkType(netDevice));
 
   auto face = std::make_shared<Face>(std::move(linkService), std::move(transport));
   face->setMetric(1);
@@ -286,7 +385,43 @@ StackHelper::PointToPointNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
 
   auto transport = make_unique<NetDeviceTransport>(node, netDevice,
                                                    constructFaceUri(netDevice),
-                                                   constructFaceUri(remoteNetDevice));
+                                                   constructFaceUri(remoteNetDevice),
+                                                   ::ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                                                   ::ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                                                   getLinkType(netDevice));
+
+  auto face = std::make_shared<Face>(std::move(linkService), std::move(transport));
+  face->setMetric(1);
+
+  ndn->addFace(face);
+  NS_LOG_LOGIC("Node " << node->GetId() << ": added Face as face #"
+                       << face->getLocalUri());
+
+  return face;
+}
+
+shared_ptr<Face>
+StackHelper::GeoBroadcastNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
+                                           Ptr<NetDevice> netDevice) const
+{
+  NS_LOG_DEBUG("Creating geo-broadcast Face on node " << node->GetId());
+
+  ::nfd::face::GenericLinkService::Options opts;
+  opts.allowFragmentation = true;
+  opts.allowReassembly = true;
+  if (isLpAggregationEnabled(netDevice)) {
+    opts.allowAggregation = true;
+    opts.aggregationHoldTime = time::nanoseconds(m_lpAggregationHoldTime.GetNanoSeconds());
+  }
+
+  auto linkService = make_unique<::nfd::face::GenericLinkService>(opts);
+
+  auto transport = make_unique<NetDeviceTransport>(node, netDevice,
+                                                   constructFaceUri(netDevice),
+                                                   "netdev://[ff:ff:ff:ff:ff:ff]",
+                                                   ::ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                                                   ::ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                                                   getLinkType(netDevice));
 
   auto face = std::make_shared<Face>(std::move(linkService), std::move(transport));
   face->setMetric(1);
@@ -30,6 +30,8 @@
 #include "ndn-fib-helper.hpp"
 #include "ndn-strategy-choice-helper.hpp"
 
+#include <boost/property_tree/ptree.hpp>
+
 namespace nfd {
 namespace cs {
 class Policy;
@@ -85,6 +87,38 @@ public:
   void
   setPolicy(const std::string& policy);
 
+  /**
+   * @brief Aggregate packets sent on ad hoc faces within @p holdTime into one link-layer frame
+   */
+  void
+  setLpAggregation(Time holdTime);
+
+  /**
+   * @brief Set the spatio-temporal scope of every DENM type
+   * @param spatialRange distance from the event (in meters) within which a DENM is forwarded
+   * @param temporalRange time after the event during which a DENM is forwarded
+   *
+   * Scopes are written to the 'denm_scope' subsection of the 'tables' config section of
+   * nodes installed afterwards.
+   */
+  void
+  setDenmScope(double spatialRange, Time temporalRange);
+
+  /**
+   * @brief Set the spatio-temporal scope of one DENM type
+   */
+  void
+  setDenmScope(uint32_t appType, uint32_t contentType, double spatialRange, Time temporalRange);
+
+  /**
+   * @brief Override the scope of one DENM type for events located inside a rectangular region
+   *
+   * Overrides for the same region bounds are merged into a single region.
+   */
+  void
+  setDenmScopeRegion(double minX, double minY, double maxX, double maxY,
+                     uint32_t appType, uint32_t contentType, double spatialRange, Time temporalRange);
+
   typedef Callback<shared_ptr<Face>, Ptr<Node>, Ptr<L3Protocol>, Ptr<NetDevice>>
     FaceCreateCallback;
 
@@ -118,6 +152,15 @@ public:
   void
   RemoveFaceCreateCallback(TypeId netDeviceType, FaceCreateCallback callback);
 
+  /**
+   * @brief Set the link type of faces created on NetDevices of type @p netDeviceType
+   *
+   * By default, faces on point-to-point NetDevices are LINK_TYPE_POINT_TO_POINT and all other
+   * faces are LINK_TYPE_AD_HOC.
+   */
+  void
+  SetLinkType(TypeId netDeviceType, ::ndn::nfd::LinkType linkType);
+
   /**
   * \brief Install Ndn stack on the node
   *
@@ -241,9 +284,20 @@ private:
   shared_ptr<Face>
   PointToPointNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
                                 Ptr<NetDevice> netDevice) const;
+
+  shared_ptr<Face>
+  GeoBroadcastNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
+                                Ptr<NetDevice> netDevice) const;
+
   shared_ptr<Face>
   createAndRegisterFace(Ptr<Node> node, Ptr<L3Protocol> ndn, Ptr<NetDevice> device) const;
 
+  ::ndn::nfd::LinkType
+  getLinkType(Ptr<NetDevice> netDevice) const;
+
+  bool
+  isLpAggregationEnabled(Ptr<NetDevice> netDevice) const;
+
   bool m_isForwarderStatusManagerDisabled;
   bool m_isStrategyChoiceManagerDisabled;
 
@@ -256,6 +310,9 @@ private:
 
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize = 100;
+  boost::property_tree::ptree m_denmScopeConfig;
+  bool m_isLpAggregationEnabled = false;
+  Time m_lpAggregationHoldTime;
 
   typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
   PolicyCreationCallback m_csPolicyCreationFunc;
@@ -264,6 +321,8 @@ private:
 
   typedef std::list<std::pair<TypeId, FaceCreateCallback>> NetDeviceCallbackList;
   NetDeviceCallbackList m_netDeviceCallbacks;
+
+  std::map<TypeId, ::ndn::nfd::LinkType> m_linkTypes;
 };
 
 } // namespace ndn
@@ -21,6 +21,8 @@
 
 #include "ns3/log.h"
 
+#include "ns3/ndnSIM/NFD/daemon/fw/strategy.hpp"
+
 #include "ndn-stack-helper.hpp"
 
 namespace ns3 {
@@ -73,6 +75,20 @@ StrategyChoiceHelper::InstallAll(const Name& namePrefix, const Name& strategy)
   Install(NodeContainer::GetGlobal(), namePrefix, strategy);
 }
 
+int64_t
+StrategyChoiceHelper::AssignStreams(const NodeContainer& c, const Name& namePrefix, int64_t stream)
+{
+  int64_t nStreams = 0;
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    Ptr<L3Protocol> l3Protocol = (*i)->GetObject<L3Protocol>();
+    NS_ASSERT(l3Protocol != nullptr);
+    ::nfd::fw::Strategy& strategy =
+      l3Protocol->getForwarder()->getStrategyChoice().findEffectiveStrategy(namePrefix);
+    nStreams += strategy.assignStreams(stream + nStreams);
+  }
+  return nStreams;
+}
+
 } // namespace ndn
 
 } // namespace ns
@@ -103,6 +103,14 @@ public:
   static void
   InstallAll(const Name& namePrefix);
 
+  /**
+   * @brief Assign fixed random variable stream numbers, starting at @p stream, to the
+   *        strategy effective for @p namePrefix on each node in @p c container
+   * @return number of streams assigned
+   */
+  static int64_t
+  AssignStreams(const NodeContainer& c, const Name& namePrefix, int64_t stream);
+
 private:
   static void
   sendCommand(const ControlParameters& parameters, Ptr<Node> node);
@@ -56,7 +56,8 @@ AppLinkService::doSendInterest(const Interest& interest, const nfd::EndpointId&
 }
 
 void
-AppLinkService::doSendData(const Data& data, const nfd::EndpointId& endpoint)
+AppLinkService::doSendData(const Data& data, const nfd::EndpointId& endpoint,
+                           const nfd::EgressFields& fields)
 {
   NS_LOG_FUNCTION(this << &data);
 
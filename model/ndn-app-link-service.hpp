@@ -63,7 +63,8 @@ private:
   doSendInterest(const Interest& interest, const nfd::EndpointId& endpoint) override;
 
   virtual void
-  doSendData(const Data& data, const nfd::EndpointId& endpoint) override;
+  doSendData(const Data& data, const nfd::EndpointId& endpoint,
+             const nfd::EgressFields& fields) override;
 
   virtual void
   doSendNack(const lp::Nack& nack, const nfd::EndpointId& endpoint) override;
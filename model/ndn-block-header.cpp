@@ -19,16 +19,11 @@
 
 #include "ndn-block-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
-
 #include <ndn-cxx/encoding/tlv.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/lp/packet.hpp>
 
-namespace io = boost::iostreams;
 namespace nfdFace = nfd::face;
 
 namespace ns3 {
@@ -73,37 +68,53 @@ BlockHeader::Serialize(ns3::Buffer::Iterator start) const
   start.Write(m_block.wire(), m_block.size());
 }
 
-class Ns3BufferIteratorSource : public io::source {
-public:
-  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-    : m_is(is)
-  {
+/**
+ * @brief Read a TLV-TYPE or TLV-LENGTH number from @p i
+ * @param[in,out] nOctets incremented by the size of the number
+ */
+static uint64_t
+readVarNumber(ns3::Buffer::Iterator& i, uint32_t& nOctets)
+{
+  if (i.GetRemainingSize() < 1) {
+    NDN_THROW(::ndn::tlv::Error("Insufficient data during TLV parsing"));
   }
 
-  std::streamsize
-  read(char* buf, std::streamsize nMaxRead)
-  {
-    std::streamsize i = 0;
-    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-      buf[i] = m_is.ReadU8();
-    }
-    if (i == 0) {
-      return -1;
-    }
-    else {
-      return i;
-    }
+  uint8_t firstOctet = i.ReadU8();
+  ++nOctets;
+  if (firstOctet < 253) {
+    return firstOctet;
   }
 
-private:
-  ns3::Buffer::Iterator& m_is;
-};
+  uint32_t size = firstOctet == 253 ? 2 : (firstOctet == 254 ? 4 : 8);
+  if (i.GetRemainingSize() < size) {
+    NDN_THROW(::ndn::tlv::Error("Insufficient data during TLV parsing"));
+  }
+  nOctets += size;
+  switch (size) {
+    case 2:
+      return i.ReadNtohU16();
+    case 4:
+      return i.ReadNtohU32();
+    default:
+      return i.ReadNtohU64();
+  }
+}
 
 uint32_t
 BlockHeader::Deserialize(ns3::Buffer::Iterator start)
 {
-  io::stream<Ns3BufferIteratorSource> is(start);
-  m_block = ::ndn::Block::fromStream(is);
+  // peek TLV-TYPE and TLV-LENGTH, then copy the whole element into one buffer in a single pass
+  ns3::Buffer::Iterator i = start;
+  uint32_t headerSize = 0;
+  readVarNumber(i, headerSize); // TLV-TYPE
+  uint64_t length = readVarNumber(i, headerSize);
+  if (length > i.GetRemainingSize()) {
+    NDN_THROW(::ndn::tlv::Error("Not enough data in the buffer to fully parse TLV"));
+  }
+
+  auto buffer = make_shared<::ndn::Buffer>(headerSize + length);
+  start.Read(buffer->data(), buffer->size());
+  m_block = Block(std::move(buffer));
   return m_block.size();
 }
 
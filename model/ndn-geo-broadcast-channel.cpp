@@ -0,0 +1,235 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-geo-broadcast-channel.hpp"
+#include "ndn-geo-broadcast-net-device.hpp"
+
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <cmath>
+
+NS_LOG_COMPONENT_DEFINE("ndn.GeoBroadcastChannel");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(GeoBroadcastChannel);
+
+static const double SPEED_OF_LIGHT = 299792458.0; // m/s
+
+TypeId
+GeoBroadcastChannel::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::GeoBroadcastChannel")
+      .SetGroupName("Ndn")
+      .SetParent<Channel>()
+      .AddConstructor<GeoBroadcastChannel>()
+
+      .AddAttribute("Range", "Maximum distance in meters at which a frame is received",
+                    DoubleValue(250.0),
+                    MakeDoubleAccessor(&GeoBroadcastChannel::m_range),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("ReliableRange",
+                    "Distance in meters up to which a frame is always received "
+                    "with the Probabilistic range model",
+                    DoubleValue(150.0),
+                    MakeDoubleAccessor(&GeoBroadcastChannel::m_reliableRange),
+                    MakeDoubleChecker<double>(0.0))
+      .AddAttribute("RangeModel", "Reception model as a function of distance",
+                    EnumValue(UNIT_DISK),
+                    MakeEnumAccessor(&GeoBroadcastChannel::m_rangeModel),
+                    MakeEnumChecker(UNIT_DISK, "UnitDisk",
+                                    PROBABILISTIC, "Probabilistic"))
+      .AddAttribute("DataRate", "Rate at which frames are serialized",
+                    DataRateValue(DataRate("6Mbps")),
+                    MakeDataRateAccessor(&GeoBroadcastChannel::m_dataRate),
+                    MakeDataRateChecker())
+      .AddAttribute("FrameOverhead", "MAC header, LLC header and FCS bytes added to every frame",
+                    UintegerValue(36),
+                    MakeUintegerAccessor(&GeoBroadcastChannel::m_frameOverhead),
+                    MakeUintegerChecker<uint32_t>())
+      .AddAttribute("Preamble", "Duration of the PHY preamble and header of every frame",
+                    TimeValue(MicroSeconds(20)),
+                    MakeTimeAccessor(&GeoBroadcastChannel::m_preamble),
+                    MakeTimeChecker())
+      .AddAttribute("IndexUpdateInterval", "Maximum age of the spatial index",
+                    TimeValue(MilliSeconds(100)),
+                    MakeTimeAccessor(&GeoBroadcastChannel::m_indexUpdateInterval),
+                    MakeTimeChecker())
+      .AddAttribute("MaxSpeed", "Upper bound of device speeds in m/s, used to size the grid cells",
+                    DoubleValue(70.0),
+                    MakeDoubleAccessor(&GeoBroadcastChannel::m_maxSpeed),
+                    MakeDoubleChecker<double>(0.0));
+  return tid;
+}
+
+GeoBroadcastChannel::GeoBroadcastChannel()
+  : m_cellSize(0.0)
+  , m_isIndexValid(false)
+  , m_random(CreateObject<UniformRandomVariable>())
+{
+}
+
+void
+GeoBroadcastChannel::DoDispose()
+{
+  m_devices.clear();
+  m_mobility.clear();
+  m_indexPositions.clear();
+  m_grid.clear();
+  Channel::DoDispose();
+}
+
+uint32_t
+GeoBroadcastChannel::Add(Ptr<GeoBroadcastNetDevice> device)
+{
+  m_devices.push_back(device);
+  m_mobility.push_back(nullptr);
+  m_indexPositions.push_back(Vector());
+  m_isIndexValid = false;
+  return m_devices.size() - 1;
+}
+
+std::size_t
+GeoBroadcastChannel::GetNDevices() const
+{
+  return m_devices.size();
+}
+
+Ptr<NetDevice>
+GeoBroadcastChannel::GetDevice(std::size_t i) const
+{
+  return m_devices.at(i);
+}
+
+Time
+GeoBroadcastChannel::GetTxTime(uint32_t size) const
+{
+  return m_preamble + m_dataRate.CalculateBytesTxTime(size + m_frameOverhead);
+}
+
+void
+GeoBroadcastChannel::Transmit(uint32_t senderIndex, Ptr<const Packet> packet, uint16_t protocol,
+                              Mac48Address source, Mac48Address destination, Time txTime)
+{
+  NS_LOG_FUNCTION(this << senderIndex << packet << txTime);
+
+  UpdateIndex();
+
+  Vector senderPosition = GetPosition(senderIndex);
+  const Vector& indexed = m_indexPositions[senderIndex];
+  int64_t cellX = static_cast<int64_t>(std::floor(indexed.x / m_cellSize));
+  int64_t cellY = static_cast<int64_t>(std::floor(indexed.y / m_cellSize));
+  Time now = Simulator::Now();
+
+  for (int64_t x = cellX - 1; x <= cellX + 1; ++x) {
+    for (int64_t y = cellY - 1; y <= cellY + 1; ++y) {
+      auto cell = m_grid.find(GetCellKey(x, y));
+      if (cell == m_grid.end()) {
+        continue;
+      }
+
+      for (uint32_t i : cell->second) {
+        if (i == senderIndex) {
+          continue;
+        }
+        double distance = CalculateDistance(senderPosition, GetPosition(i));
+        if (distance > m_range) {
+          continue;
+        }
+
+        bool isLost = m_rangeModel == PROBABILISTIC &&
+                      m_random->GetValue() >= GetReceptionProbability(distance);
+        Time start = now + Seconds(distance / SPEED_OF_LIGHT);
+        m_devices[i]->StartReceive(packet, protocol, source, destination, start, start + txTime,
+                                   isLost);
+      }
+    }
+  }
+}
+
+Vector
+GeoBroadcastChannel::GetPosition(uint32_t index)
+{
+  if (m_mobility[index] == nullptr) {
+    Ptr<Node> node = m_devices[index]->GetNode();
+    if (node == nullptr) {
+      return Vector();
+    }
+    m_mobility[index] = node->GetObject<MobilityModel>();
+    if (m_mobility[index] == nullptr) {
+      return Vector();
+    }
+  }
+  return m_mobility[index]->GetPosition();
+}
+
+void
+GeoBroadcastChannel::UpdateIndex()
+{
+  Time now = Simulator::Now();
+  if (m_isIndexValid && now < m_indexTime + m_indexUpdateInterval) {
+    return;
+  }
+
+  // two devices within range are at most Range + 2 * MaxSpeed * IndexUpdateInterval apart in the
+  // index, so every neighbor of a device lies in one of the 9 cells around its indexed position
+  m_cellSize = m_range + 2 * m_maxSpeed * m_indexUpdateInterval.GetSeconds();
+  for (auto& cell : m_grid) {
+    cell.second.clear();
+  }
+
+  for (uint32_t i = 0; i < m_devices.size(); ++i) {
+    Vector position = GetPosition(i);
+    m_indexPositions[i] = position;
+    int64_t x = static_cast<int64_t>(std::floor(position.x / m_cellSize));
+    int64_t y = static_cast<int64_t>(std::floor(position.y / m_cellSize));
+    m_grid[GetCellKey(x, y)].push_back(i);
+  }
+
+  m_indexTime = now;
+  m_isIndexValid = true;
+}
+
+uint64_t
+GeoBroadcastChannel::GetCellKey(int64_t x, int64_t y)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+double
+GeoBroadcastChannel::GetReceptionProbability(double distance) const
+{
+  if (distance <= m_reliableRange) {
+    return 1.0;
+  }
+  if (distance >= m_range) {
+    return 0.0;
+  }
+  return (m_range - distance) / (m_range - m_reliableRange);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_GEO_BROADCAST_CHANNEL_HPP
+#define NDN_GEO_BROADCAST_CHANNEL_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/channel.h"
+#include "ns3/data-rate.h"
+#include "ns3/mac48-address.h"
+#include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+
+class GeoBroadcastNetDevice;
+
+/**
+ * \ingroup ndn
+ * \brief Lightweight broadcast channel for large vehicular simulations
+ *
+ * GeoBroadcastChannel replaces the PHY and propagation models of a wireless channel with a
+ * geometric range model. A frame reaches every device within Range of the sender, found through
+ * a uniform grid of the device positions, after its serialization time at DataRate. Frames that
+ * overlap in time at a receiver are lost, which approximates collisions; senders defer while
+ * the medium is busy (see GeoBroadcastNetDevice).
+ *
+ * With the PROBABILISTIC range model, a frame is received with probability 1 up to
+ * ReliableRange, decreasing linearly to 0 at Range.
+ *
+ * The grid is rebuilt at most every IndexUpdateInterval. Cells are sized so that no neighbor is
+ * missed as long as devices move slower than MaxSpeed.
+ */
+class GeoBroadcastChannel : public Channel
+{
+public:
+  enum RangeModel {
+    UNIT_DISK,
+    PROBABILISTIC
+  };
+
+  static TypeId
+  GetTypeId();
+
+  GeoBroadcastChannel();
+
+  /**
+   * \brief Attach \p device to the channel
+   * \return index of the device on the channel
+   */
+  uint32_t
+  Add(Ptr<GeoBroadcastNetDevice> device);
+
+  std::size_t
+  GetNDevices() const override;
+
+  Ptr<NetDevice>
+  GetDevice(std::size_t i) const override;
+
+  /**
+   * \brief Time a frame of \p size bytes occupies the medium
+   */
+  Time
+  GetTxTime(uint32_t size) const;
+
+  /**
+   * \brief Broadcast \p packet from the device at \p senderIndex, occupying the medium for \p txTime
+   *
+   * Every device within range starts receiving the frame after the propagation delay.
+   */
+  void
+  Transmit(uint32_t senderIndex, Ptr<const Packet> packet, uint16_t protocol,
+           Mac48Address source, Mac48Address destination, Time txTime);
+
+protected:
+  void
+  DoDispose() override;
+
+private:
+  Vector
+  GetPosition(uint32_t index);
+
+  void
+  UpdateIndex();
+
+  static uint64_t
+  GetCellKey(int64_t x, int64_t y);
+
+  double
+  GetReceptionProbability(double distance) const;
+
+private:
+  std::vector<Ptr<GeoBroadcastNetDevice>> m_devices;
+  std::vector<Ptr<MobilityModel>> m_mobility; ///< \brief mobility of each device, if any
+  std::vector<Vector> m_indexPositions;       ///< \brief position of each device in the grid
+  std::unordered_map<uint64_t, std::vector<uint32_t>> m_grid;
+  double m_cellSize;
+  Time m_indexTime;
+  bool m_isIndexValid;
+
+  double m_range;
+  double m_reliableRange;
+  RangeModel m_rangeModel;
+  DataRate m_dataRate;
+  uint32_t m_frameOverhead;
+  Time m_preamble;
+  Time m_indexUpdateInterval;
+  double m_maxSpeed;
+  Ptr<UniformRandomVariable> m_random;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_GEO_BROADCAST_CHANNEL_HPP
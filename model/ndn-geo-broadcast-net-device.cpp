@@ -0,0 +1,396 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-geo-broadcast-net-device.hpp"
+#include "ndn-geo-broadcast-channel.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.GeoBroadcastNetDevice");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(GeoBroadcastNetDevice);
+
+TypeId
+GeoBroadcastNetDevice::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::GeoBroadcastNetDevice")
+      .SetGroupName("Ndn")
+      .SetParent<NetDevice>()
+      .AddConstructor<GeoBroadcastNetDevice>()
+
+      .AddAttribute("Mtu", "MAC-level Maximum Transmission Unit",
+                    UintegerValue(1500),
+                    MakeUintegerAccessor(&GeoBroadcastNetDevice::m_mtu),
+                    MakeUintegerChecker<uint16_t>())
+      .AddAttribute("MaxQueueSize", "Maximum number of frames waiting for transmission",
+                    UintegerValue(100),
+                    MakeUintegerAccessor(&GeoBroadcastNetDevice::m_maxQueueSize),
+                    MakeUintegerChecker<uint32_t>(1))
+      .AddAttribute("SlotTime", "Duration of a backoff slot",
+                    TimeValue(MicroSeconds(9)),
+                    MakeTimeAccessor(&GeoBroadcastNetDevice::m_slotTime),
+                    MakeTimeChecker())
+      .AddAttribute("ContentionWindow", "Maximum number of backoff slots",
+                    UintegerValue(15),
+                    MakeUintegerAccessor(&GeoBroadcastNetDevice::m_contentionWindow),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddTraceSource("MacTx", "A frame has been put on the air",
+                      MakeTraceSourceAccessor(&GeoBroadcastNetDevice::m_macTxTrace),
+                      "ns3::Packet::TracedCallback")
+      .AddTraceSource("MacTxDrop", "A frame has been dropped because the queue is full",
+                      MakeTraceSourceAccessor(&GeoBroadcastNetDevice::m_macTxDropTrace),
+                      "ns3::Packet::TracedCallback")
+      .AddTraceSource("MacRx", "A frame has been received",
+                      MakeTraceSourceAccessor(&GeoBroadcastNetDevice::m_macRxTrace),
+                      "ns3::Packet::TracedCallback")
+      .AddTraceSource("PhyRxDrop", "A frame has been lost to range, collision or half duplex",
+                      MakeTraceSourceAccessor(&GeoBroadcastNetDevice::m_phyRxDropTrace),
+                      "ns3::Packet::TracedCallback");
+  return tid;
+}
+
+GeoBroadcastNetDevice::GeoBroadcastNetDevice()
+  : m_channelIndex(0)
+  , m_ifIndex(0)
+  , m_mtu(1500)
+  , m_maxQueueSize(100)
+  , m_isTransmitting(false)
+  , m_contentionWindow(15)
+  , m_random(CreateObject<UniformRandomVariable>())
+{
+}
+
+void
+GeoBroadcastNetDevice::DoDispose()
+{
+  m_backoffEvent.Cancel();
+  m_queue.clear();
+  m_lastReception.reset();
+  m_channel = nullptr;
+  m_node = nullptr;
+  m_rxCallback.Nullify();
+  m_promiscCallback.Nullify();
+  NetDevice::DoDispose();
+}
+
+void
+GeoBroadcastNetDevice::SetChannel(Ptr<GeoBroadcastChannel> channel)
+{
+  m_channel = channel;
+  m_channelIndex = channel->Add(this);
+  m_linkChangeCallbacks();
+}
+
+uint32_t
+GeoBroadcastNetDevice::GetQueueBytes() const
+{
+  uint32_t nBytes = 0;
+  for (const Frame& frame : m_queue) {
+    nBytes += frame.packet->GetSize();
+  }
+  return nBytes;
+}
+
+bool
+GeoBroadcastNetDevice::Send(Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber)
+{
+  return SendFrom(packet, m_address, dest, protocolNumber);
+}
+
+bool
+GeoBroadcastNetDevice::SendFrom(Ptr<Packet> packet, const Address& source, const Address& dest,
+                                uint16_t protocolNumber)
+{
+  NS_LOG_FUNCTION(this << packet << source << dest << protocolNumber);
+
+  if (m_channel == nullptr) {
+    return false;
+  }
+
+  if (m_queue.size() >= m_maxQueueSize) {
+    NS_LOG_DEBUG("Queue full, dropping frame");
+    m_macTxDropTrace(packet);
+    return false;
+  }
+
+  m_queue.push_back(Frame{packet, protocolNumber, Mac48Address::ConvertFrom(source),
+                          Mac48Address::ConvertFrom(dest)});
+  if (!m_isTransmitting && !m_backoffEvent.IsRunning()) {
+    TryTransmit();
+  }
+  return true;
+}
+
+void
+GeoBroadcastNetDevice::TryTransmit()
+{
+  if (m_queue.empty()) {
+    return;
+  }
+
+  if (m_rxEnd > Simulator::Now()) {
+    NS_LOG_DEBUG("Medium busy until " << m_rxEnd.As(Time::US) << ", deferring");
+    ScheduleBackoff(m_rxEnd);
+    return;
+  }
+
+  Frame frame = std::move(m_queue.front());
+  m_queue.pop_front();
+
+  Time txTime = m_channel->GetTxTime(frame.packet->GetSize());
+  m_isTransmitting = true;
+  m_macTxTrace(frame.packet);
+  m_channel->Transmit(m_channelIndex, frame.packet, frame.protocol, frame.source,
+                      frame.destination, txTime);
+  Simulator::Schedule(txTime, &GeoBroadcastNetDevice::EndTransmit, this);
+}
+
+void
+GeoBroadcastNetDevice::EndTransmit()
+{
+  m_isTransmitting = false;
+  if (!m_queue.empty()) {
+    // back off after every transmission so that a busy sender does not monopolize the medium
+    ScheduleBackoff(Simulator::Now());
+  }
+}
+
+void
+GeoBroadcastNetDevice::ScheduleBackoff(Time idleTime)
+{
+  // DIFS of the 802.11 OFDM PHYs: SIFS (16us) + 2 slots
+  Time difs = MicroSeconds(16) + m_slotTime + m_slotTime;
+  Time backoff = NanoSeconds(m_slotTime.GetNanoSeconds() * m_random->GetInteger(0, m_contentionWindow));
+  m_backoffEvent = Simulator::Schedule(idleTime - Simulator::Now() + difs + backoff,
+                                       &GeoBroadcastNetDevice::TryTransmit, this);
+}
+
+void
+GeoBroadcastNetDevice::StartReceive(Ptr<const Packet> packet, uint16_t protocol,
+                                    Mac48Address source, Mac48Address destination, Time start,
+                                    Time end, bool isLost)
+{
+  NS_LOG_FUNCTION(this << packet << source << start << end << isLost);
+
+  if (m_isTransmitting) {
+    NS_LOG_DEBUG("Transmitting, frame from " << source << " is lost");
+    m_phyRxDropTrace(packet);
+    return;
+  }
+
+  auto reception = make_shared<Reception>(Reception{Frame{packet, protocol, source, destination},
+                                                    isLost});
+  if (start < m_rxEnd) {
+    // frames overlapping at this receiver collide
+    NS_LOG_DEBUG("Collision with the frame on the air");
+    reception->isCorrupted = true;
+    if (m_lastReception != nullptr) {
+      m_lastReception->isCorrupted = true;
+    }
+  }
+  if (end > m_rxEnd) {
+    m_rxEnd = end;
+    m_lastReception = reception;
+  }
+
+  Simulator::ScheduleWithContext(m_node->GetId(), end - Simulator::Now(),
+                                 &GeoBroadcastNetDevice::EndReceive, this, reception);
+}
+
+void
+GeoBroadcastNetDevice::EndReceive(shared_ptr<Reception> reception)
+{
+  if (m_lastReception == reception) {
+    m_lastReception.reset();
+  }
+
+  const Frame& frame = reception->frame;
+  if (reception->isCorrupted) {
+    m_phyRxDropTrace(frame.packet);
+    return;
+  }
+
+  PacketType packetType;
+  if (frame.destination == m_address) {
+    packetType = PACKET_HOST;
+  }
+  else if (frame.destination.IsBroadcast()) {
+    packetType = PACKET_BROADCAST;
+  }
+  else if (frame.destination.IsGroup()) {
+    packetType = PACKET_MULTICAST;
+  }
+  else {
+    packetType = PACKET_OTHERHOST;
+  }
+
+  if (!m_promiscCallback.IsNull()) {
+    m_promiscCallback(this, frame.packet, frame.protocol, frame.source, frame.destination,
+                      packetType);
+  }
+  if (packetType != PACKET_OTHERHOST) {
+    m_macRxTrace(frame.packet);
+    if (!m_rxCallback.IsNull()) {
+      m_rxCallback(this, frame.packet, frame.protocol, frame.source);
+    }
+  }
+}
+
+void
+GeoBroadcastNetDevice::SetIfIndex(const uint32_t index)
+{
+  m_ifIndex = index;
+}
+
+uint32_t
+GeoBroadcastNetDevice::GetIfIndex() const
+{
+  return m_ifIndex;
+}
+
+Ptr<Channel>
+GeoBroadcastNetDevice::GetChannel() const
+{
+  return m_channel;
+}
+
+void
+GeoBroadcastNetDevice::SetAddress(Address address)
+{
+  m_address = Mac48Address::ConvertFrom(address);
+}
+
+Address
+GeoBroadcastNetDevice::GetAddress() const
+{
+  return m_address;
+}
+
+bool
+GeoBroadcastNetDevice::SetMtu(const uint16_t mtu)
+{
+  m_mtu = mtu;
+  return true;
+}
+
+uint16_t
+GeoBroadcastNetDevice::GetMtu() const
+{
+  return m_mtu;
+}
+
+bool
+GeoBroadcastNetDevice::IsLinkUp() const
+{
+  return m_channel != nullptr;
+}
+
+void
+GeoBroadcastNetDevice::AddLinkChangeCallback(Callback<void> callback)
+{
+  m_linkChangeCallbacks.ConnectWithoutContext(callback);
+}
+
+bool
+GeoBroadcastNetDevice::IsBroadcast() const
+{
+  return true;
+}
+
+Address
+GeoBroadcastNetDevice::GetBroadcast() const
+{
+  return Mac48Address::GetBroadcast();
+}
+
+bool
+GeoBroadcastNetDevice::IsMulticast() const
+{
+  return true;
+}
+
+Address
+GeoBroadcastNetDevice::GetMulticast(Ipv4Address multicastGroup) const
+{
+  return Mac48Address::GetMulticast(multicastGroup);
+}
+
+Address
+GeoBroadcastNetDevice::GetMulticast(Ipv6Address addr) const
+{
+  return Mac48Address::GetMulticast(addr);
+}
+
+bool
+GeoBroadcastNetDevice::IsBridge() const
+{
+  return false;
+}
+
+bool
+GeoBroadcastNetDevice::IsPointToPoint() const
+{
+  return false;
+}
+
+Ptr<Node>
+GeoBroadcastNetDevice::GetNode() const
+{
+  return m_node;
+}
+
+void
+GeoBroadcastNetDevice::SetNode(Ptr<Node> node)
+{
+  m_node = node;
+}
+
+bool
+GeoBroadcastNetDevice::NeedsArp() const
+{
+  return false;
+}
+
+void
+GeoBroadcastNetDevice::SetReceiveCallback(NetDevice::ReceiveCallback cb)
+{
+  m_rxCallback = cb;
+}
+
+void
+GeoBroadcastNetDevice::SetPromiscReceiveCallback(NetDevice::PromiscReceiveCallback cb)
+{
+  m_promiscCallback = cb;
+}
+
+bool
+GeoBroadcastNetDevice::SupportsSendFrom() const
+{
+  return true;
+}
+
+} // namespace ndn
+} // namespace ns3
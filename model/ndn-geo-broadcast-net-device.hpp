@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_GEO_BROADCAST_NET_DEVICE_HPP
+#define NDN_GEO_BROADCAST_NET_DEVICE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/event-id.h"
+#include "ns3/mac48-address.h"
+#include "ns3/net-device.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/traced-callback.h"
+
+#include <deque>
+
+namespace ns3 {
+namespace ndn {
+
+class GeoBroadcastChannel;
+
+/**
+ * \ingroup ndn
+ * \brief NetDevice attached to a GeoBroadcastChannel
+ *
+ * The device keeps outgoing frames in a FIFO queue of up to MaxQueueSize frames and sends them
+ * one at a time with a CSMA-like access scheme. A frame is sent right away if the medium is
+ * idle. Otherwise the device waits until the medium becomes idle, then for a DIFS and a random
+ * backoff of up to ContentionWindow slots, and senses the medium again. The device is half
+ * duplex: frames arriving while it transmits are lost.
+ *
+ * Received frames are delivered to the node without being copied.
+ */
+class GeoBroadcastNetDevice : public NetDevice
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  GeoBroadcastNetDevice();
+
+  /**
+   * \brief Attach the device to \p channel
+   */
+  void
+  SetChannel(Ptr<GeoBroadcastChannel> channel);
+
+  /**
+   * \brief Number of frames waiting for transmission, excluding the frame on the air
+   */
+  size_t
+  GetQueueLength() const
+  {
+    return m_queue.size();
+  }
+
+  /**
+   * \brief Number of bytes waiting for transmission, excluding the frame on the air
+   */
+  uint32_t
+  GetQueueBytes() const;
+
+  /**
+   * \brief Start receiving a frame, invoked by the channel
+   * \param start time at which the first bit arrives
+   * \param end time at which the last bit arrives
+   * \param isLost whether the range model drops the frame
+   */
+  void
+  StartReceive(Ptr<const Packet> packet, uint16_t protocol, Mac48Address source,
+               Mac48Address destination, Time start, Time end, bool isLost);
+
+public: // NetDevice
+  void
+  SetIfIndex(const uint32_t index) override;
+
+  uint32_t
+  GetIfIndex() const override;
+
+  Ptr<Channel>
+  GetChannel() const override;
+
+  void
+  SetAddress(Address address) override;
+
+  Address
+  GetAddress() const override;
+
+  bool
+  SetMtu(const uint16_t mtu) override;
+
+  uint16_t
+  GetMtu() const override;
+
+  bool
+  IsLinkUp() const override;
+
+  void
+  AddLinkChangeCallback(Callback<void> callback) override;
+
+  bool
+  IsBroadcast() const override;
+
+  Address
+  GetBroadcast() const override;
+
+  bool
+  IsMulticast() const override;
+
+  Address
+  GetMulticast(Ipv4Address multicastGroup) const override;
+
+  Address
+  GetMulticast(Ipv6Address addr) const override;
+
+  bool
+  IsBridge() const override;
+
+  bool
+  IsPointToPoint() const override;
+
+  bool
+  Send(Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber) override;
+
+  bool
+  SendFrom(Ptr<Packet> packet, const Address& source, const Address& dest,
+           uint16_t protocolNumber) override;
+
+  Ptr<Node>
+  GetNode() const override;
+
+  void
+  SetNode(Ptr<Node> node) override;
+
+  bool
+  NeedsArp() const override;
+
+  void
+  SetReceiveCallback(NetDevice::ReceiveCallback cb) override;
+
+  void
+  SetPromiscReceiveCallback(NetDevice::PromiscReceiveCallback cb) override;
+
+  bool
+  SupportsSendFrom() const override;
+
+protected:
+  void
+  DoDispose() override;
+
+private:
+  struct Frame
+  {
+    Ptr<const Packet> packet;
+    uint16_t protocol;
+    Mac48Address source;
+    Mac48Address destination;
+  };
+
+  struct Reception
+  {
+    Frame frame;
+    bool isCorrupted;
+  };
+
+  void
+  TryTransmit();
+
+  void
+  EndTransmit();
+
+  void
+  ScheduleBackoff(Time idleTime);
+
+  void
+  EndReceive(shared_ptr<Reception> reception);
+
+private:
+  Ptr<GeoBroadcastChannel> m_channel;
+  uint32_t m_channelIndex;
+  Ptr<Node> m_node;
+  Mac48Address m_address;
+  uint32_t m_ifIndex;
+  uint16_t m_mtu;
+
+  std::deque<Frame> m_queue;
+  uint32_t m_maxQueueSize;
+  bool m_isTransmitting;
+  EventId m_backoffEvent;
+  Time m_slotTime;
+  uint32_t m_contentionWindow;
+  Ptr<UniformRandomVariable> m_random;
+
+  Time m_rxEnd; ///< \brief end of the last frame heard, medium is busy until then
+  shared_ptr<Reception> m_lastReception;
+
+  NetDevice::ReceiveCallback m_rxCallback;
+  NetDevice::PromiscReceiveCallback m_promiscCallback;
+  TracedCallback<> m_linkChangeCallbacks;
+
+  TracedCallback<Ptr<const Packet>> m_macTxTrace;
+  TracedCallback<Ptr<const Packet>> m_macTxDropTrace;
+  TracedCallback<Ptr<const Packet>> m_macRxTrace;
+  TracedCallback<Ptr<const Packet>> m_phyRxDropTrace;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_GEO_BROADCAST_NET_DEVICE_HPP
@@ -30,6 +30,9 @@
 #include "ns3/simulator.h"
 
 #include "ndn-net-device-transport.hpp"
+#include "ndn-position-cache.hpp"
+
+#include "ns3/mobility-model.h"
 
 #include "../helper/ndn-stack-helper.hpp"
 
@@ -46,6 +49,7 @@
 // #include "ns3/ndnSIM/NFD/daemon/mgmt/general-config-section.hpp"
 #include "ns3/ndnSIM/NFD/daemon/mgmt/tables-config-section.hpp"
 #include "ns3/ndnSIM/NFD/daemon/mgmt/command-authenticator.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/cs-policy-geo-temporal.hpp"
 
 #include "ns3/ndnSIM/NFD/daemon/rib/service.hpp"
 
@@ -105,6 +109,16 @@ L3Protocol::GetTypeId(void)
       .AddTraceSource("TimedOutInterests", "TimedOutInterests",
                       MakeTraceSourceAccessor(&L3Protocol::m_timedOutInterests),
                       "ns3::ndn::L3Protocol::TimedOutInterestsCallback")
+
+      ////////////////////////////////////////////////////////////////////
+
+      .AddTraceSource("DenmDecisions", "DENM forwarding decisions of the effective strategy",
+                      MakeTraceSourceAccessor(&L3Protocol::m_denmDecisions),
+                      "ns3::ndn::L3Protocol::DenmDecisionsCallback")
+
+      .AddTraceSource("DccStates", "DENM congestion control state changes of the faces",
+                      MakeTraceSourceAccessor(&L3Protocol::m_dccStates),
+                      "ns3::ndn::L3Protocol::DccStatesCallback")
     ;
   return tid;
 }
@@ -194,6 +208,8 @@ private:
   nfd::ConfigSection m_config;
 
   PolicyCreationCallback m_policy;
+
+  PositionCache m_positionCache;
 };
 
 L3Protocol::L3Protocol()
@@ -212,6 +228,8 @@ L3Protocol::initialize()
 {
   m_impl->m_faceTable = make_unique<::nfd::FaceTable>();
   m_impl->m_forwarder = make_shared<::nfd::Forwarder>(*m_impl->m_faceTable);
+  m_impl->m_positionCache.attach(m_node->GetObject<MobilityModel>());
+  m_impl->m_forwarder->setNode(m_node, m_impl->m_positionCache);
   m_impl->m_faceSystem = make_unique<::nfd::face::FaceSystem>(*m_impl->m_faceTable, nullptr);
 
   initializeManagement();
@@ -219,6 +237,8 @@ L3Protocol::initialize()
 
   m_impl->m_forwarder->beforeSatisfyInterest.connect(std::ref(m_satisfiedInterests));
   m_impl->m_forwarder->beforeExpirePendingInterest.connect(std::ref(m_timedOutInterests));
+  m_impl->m_forwarder->afterDenmDecision.connect(std::ref(m_denmDecisions));
+  m_impl->m_forwarder->afterDccStateChange.connect(std::ref(m_dccStates));
 }
 
 class IgnoreSections
@@ -289,6 +309,11 @@ L3Protocol::initializeManagement()
   ConfigFile config(&ConfigFile::ignoreUnknownSection);
 
   forwarder->getCs().setPolicy(m_impl->m_policy());
+  // the geo-temporal policy ranks DENMs by the scopes and the position of this node
+  auto geoTemporalPolicy = dynamic_cast<::nfd::cs::GeoTemporalPolicy*>(forwarder->getCs().getPolicy());
+  if (geoTemporalPolicy != nullptr) {
+    geoTemporalPolicy->setContext(forwarder->getDenmScopeTable(), &m_impl->m_positionCache);
+  }
 
   TablesConfigSection tablesConfig(*forwarder);
   tablesConfig.setConfigFile(config);
@@ -354,6 +379,12 @@ L3Protocol::getRibService()
   return *m_impl->m_ribService;
 }
 
+const PositionCache&
+L3Protocol::getPositionCache() const
+{
+  return m_impl->m_positionCache;
+}
+
 nfd::ConfigSection&
 L3Protocol::getConfig()
 {
@@ -373,6 +404,10 @@ L3Protocol::NotifyNewAggregate()
       initialize();
     }
   }
+  else if (!m_impl->m_positionCache.isAttached()) {
+    // mobility model aggregated after the stack was installed
+    m_impl->m_positionCache.attach(m_node->GetObject<MobilityModel>());
+  }
 
   Object::NotifyNewAggregate();
 }
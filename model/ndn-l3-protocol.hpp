@@ -21,6 +21,8 @@
 #define NDN_L3_PROTOCOL_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-dcc.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-decision.hpp"
 
 #include <list>
 #include <vector>
@@ -57,6 +59,8 @@ class Header;
 
 namespace ndn {
 
+class PositionCache;
+
 /**
  * \defgroup ndn ndnSIM: NDN simulation module
  *
@@ -154,6 +158,12 @@ public:
   shared_ptr<Face>
   getFaceByNetDevice(Ptr<NetDevice> netDevice) const;
 
+  /**
+   * \brief Get the cached position of the node on which the stack is installed
+   */
+  const PositionCache&
+  getPositionCache() const;
+
   /**
    * \brief Get NFD config (boost::property_tree)
    */
@@ -185,6 +195,10 @@ public:
   typedef void (*SatisfiedInterestsCallback)(const nfd::pit::Entry& pitEntry, const Face& inFace, const Data& data);
   typedef void (*TimedOutInterestsCallback)(const nfd::pit::Entry& pitEntry);
 
+  typedef void (*DenmDecisionsCallback)(const Name& dataName, nfd::fw::DenmDecision decision,
+                                        time::nanoseconds delay);
+  typedef void (*DccStatesCallback)(const Face& face, nfd::fw::DccState state, double cbr);
+
 protected:
   virtual void
   DoDispose(void); ///< @brief Do cleanup
@@ -228,6 +242,11 @@ private:
 
   TracedCallback<const nfd::pit::Entry&, const Face&/*in face*/, const Data&> m_satisfiedInterests;
   TracedCallback<const nfd::pit::Entry&> m_timedOutInterests;
+
+  TracedCallback<const Name&, nfd::fw::DenmDecision, time::nanoseconds>
+    m_denmDecisions; ///< @brief trace of DENM forwarding decisions
+  TracedCallback<const Face&, nfd::fw::DccState, double>
+    m_dccStates; ///< @brief trace of DENM congestion control state changes
 };
 
 } // namespace ndn
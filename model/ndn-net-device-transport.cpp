@@ -21,19 +21,54 @@
 
 #include "../helper/ndn-stack-helper.hpp"
 #include "ndn-block-header.hpp"
+#include "ndn-geo-broadcast-net-device.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
+#include <ndn-cxx/lp/geo-tag.hpp>
+#include <ndn-cxx/lp/tlv.hpp>
 
+#include "ns3/boolean.h"
 #include "ns3/queue.h"
+#include "ns3/txop.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-net-device.h"
 
 NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceTransport");
 
 namespace ns3 {
 namespace ndn {
 
+const time::nanoseconds NetDeviceTransport::DEFAULT_NEIGHBOR_LIFETIME = time::seconds(2);
+const size_t NetDeviceTransport::DEVICE_QUEUE_BUDGET = 1;
+
+/**
+ * \brief Get the queue of the channel access function that sends NDN frames on a WifiNetDevice
+ *
+ * NDN frames carry no QoS tag, so a QoS MAC sends them with the best effort access category.
+ */
+static Ptr<WifiMacQueue>
+getWifiMacQueue(const Ptr<NetDevice>& netDevice)
+{
+  auto wifiDevice = DynamicCast<WifiNetDevice>(netDevice);
+  if (wifiDevice == nullptr || wifiDevice->GetMac() == nullptr) {
+    return nullptr;
+  }
+
+  BooleanValue isQosSupported(false);
+  wifiDevice->GetMac()->GetAttributeFailSafe("QosSupported", isQosSupported);
+
+  PointerValue txop;
+  if (!wifiDevice->GetMac()->GetAttributeFailSafe(isQosSupported.Get() ? "BE_Txop" : "Txop", txop) ||
+      txop.Get<Txop>() == nullptr) {
+    return nullptr;
+  }
+  return txop.Get<Txop>()->GetWifiMacQueue();
+}
+
 NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
                                        const Ptr<NetDevice>& netDevice,
                                        const std::string& localUri,
@@ -43,6 +78,7 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
                                        ::ndn::nfd::LinkType linkType)
   : m_netDevice(netDevice)
   , m_node(node)
+  , m_neighborLifetime(DEFAULT_NEIGHBOR_LIFETIME)
 {
   this->setLocalUri(FaceUri(localUri));
   this->setRemoteUri(FaceUri(remoteUri));
@@ -54,10 +90,17 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
   // Get send queue capacity for congestion marking
   PointerValue txQueueAttribute;
   if (m_netDevice->GetAttributeFailSafe("TxQueue", txQueueAttribute)) {
-    Ptr<ns3::QueueBase> txQueue = txQueueAttribute.Get<ns3::QueueBase>();
-    // must be put into bytes mode queue
+    m_deviceQueue = txQueueAttribute.Get<ns3::QueueBase>();
+    m_dequeueCallback = MakeCallback(&NetDeviceTransport::onDeviceDequeue<ns3::Packet>, this);
+  }
+  else if (Ptr<WifiMacQueue> wifiQueue = getWifiMacQueue(m_netDevice)) {
+    m_deviceQueue = wifiQueue;
+    m_dequeueCallback = MakeCallback(&NetDeviceTransport::onDeviceDequeue<WifiMacQueueItem>, this);
+  }
 
-    auto size = txQueue->GetMaxSize();
+  if (m_deviceQueue != nullptr) {
+    // must be put into bytes mode queue
+    auto size = m_deviceQueue->GetMaxSize();
     if (size.GetUnit() == BYTES) {
       this->setSendQueueCapacity(size.GetValue());
     }
@@ -67,6 +110,26 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
     }
   }
 
+  // Packets of all priorities share an ad hoc link. They wait in the egress queue, which releases
+  // them to the NetDevice queue whenever the device takes a frame for transmission, so that an
+  // urgent packet never waits behind more than DEVICE_QUEUE_BUDGET frames in the device.
+  if (linkType != ::ndn::nfd::LINK_TYPE_POINT_TO_POINT) {
+    if (m_deviceQueue != nullptr) {
+      m_dequeueSource = m_deviceQueue;
+      m_dequeueTrace = "Dequeue";
+    }
+    else if (DynamicCast<GeoBroadcastNetDevice>(m_netDevice) != nullptr) {
+      m_dequeueSource = m_netDevice;
+      m_dequeueTrace = "MacTx";
+      m_dequeueCallback = MakeCallback(&NetDeviceTransport::onDeviceDequeue<ns3::Packet>, this);
+    }
+
+    if (m_dequeueSource != nullptr &&
+        m_dequeueSource->TraceConnectWithoutContext(m_dequeueTrace, m_dequeueCallback)) {
+      m_egressQueue = make_unique<PriorityEgressQueue>();
+    }
+  }
+
   NS_LOG_FUNCTION(this << "Creating an ndnSIM transport instance for netDevice with URI"
                   << this->getLocalUri());
 
@@ -80,19 +143,40 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
 NetDeviceTransport::~NetDeviceTransport()
 {
   NS_LOG_FUNCTION_NOARGS();
+
+  if (m_egressQueue != nullptr) {
+    m_dequeueSource->TraceDisconnectWithoutContext(m_dequeueTrace, m_dequeueCallback);
+  }
+  Simulator::Cancel(m_drainEvent);
 }
 
 ssize_t
 NetDeviceTransport::getSendQueueLength()
 {
-  PointerValue txQueueAttribute;
-  if (m_netDevice->GetAttributeFailSafe("TxQueue", txQueueAttribute)) {
-    Ptr<ns3::QueueBase> txQueue = txQueueAttribute.Get<ns3::QueueBase>();
-    return txQueue->GetNBytes();
+  ssize_t length = nfd::face::QUEUE_UNSUPPORTED;
+  if (m_deviceQueue != nullptr) {
+    length = m_deviceQueue->GetNBytes();
   }
-  else {
-    return nfd::face::QUEUE_UNSUPPORTED;
+  else if (auto geoDevice = DynamicCast<GeoBroadcastNetDevice>(m_netDevice)) {
+    length = geoDevice->GetQueueBytes();
   }
+
+  if (length >= 0 && m_egressQueue != nullptr) {
+    length += m_egressQueue->getNBytes();
+  }
+  return length;
+}
+
+size_t
+NetDeviceTransport::getDeviceQueueLength() const
+{
+  if (m_deviceQueue != nullptr) {
+    return m_deviceQueue->GetNPackets();
+  }
+  else if (auto geoDevice = DynamicCast<GeoBroadcastNetDevice>(m_netDevice)) {
+    return geoDevice->GetQueueLength();
+  }
+  return 0;
 }
 
 void
@@ -111,15 +195,59 @@ NetDeviceTransport::doSend(const Block& packet, const nfd::EndpointId& endpoint)
   NS_LOG_FUNCTION(this << "Sending packet from netDevice with URI"
                   << this->getLocalUri());
 
+  if (m_egressQueue == nullptr) {
+    sendToNetDevice(packet, endpoint);
+    return;
+  }
+
+  if (!m_egressQueue->enqueue(packet, endpoint)) {
+    NS_LOG_DEBUG("Egress class " << PriorityEgressQueue::classify(packet)
+                 << " is full, dropping packet");
+    return;
+  }
+  drainEgressQueue();
+}
+
+void
+NetDeviceTransport::sendToNetDevice(const Block& packet, const nfd::EndpointId& endpoint)
+{
   // convert NFD packet to NS3 packet
   BlockHeader header(packet);
 
   Ptr<ns3::Packet> ns3Packet = Create<ns3::Packet>();
   ns3Packet->AddHeader(header);
 
+  Address destination = m_netDevice->GetBroadcast();
+  if (endpoint != 0) {
+    auto neighbor = m_neighbors.find(endpoint);
+    if (neighbor != m_neighbors.end() &&
+        neighbor->second.lastHeard + m_neighborLifetime > time::steady_clock::now()) {
+      // 802.11 acknowledges and retransmits unicast frames, and sends them at the data rate
+      // rather than the basic rate
+      destination = neighbor->second.address;
+    }
+  }
+
   // send the NS3 packet
-  m_netDevice->Send(ns3Packet, m_netDevice->GetBroadcast(),
-                    L3Protocol::ETHERNET_FRAME_TYPE);
+  m_netDevice->Send(ns3Packet, destination, L3Protocol::ETHERNET_FRAME_TYPE);
+}
+
+void
+NetDeviceTransport::drainEgressQueue()
+{
+  while (!m_egressQueue->empty() && getDeviceQueueLength() < DEVICE_QUEUE_BUDGET) {
+    PriorityEgressQueue::Item item = m_egressQueue->dequeue();
+    sendToNetDevice(item.packet, item.endpoint);
+  }
+}
+
+void
+NetDeviceTransport::scheduleDrain()
+{
+  // the device may be in the middle of its transmit state machine, which must not be reentered
+  if (!m_drainEvent.IsRunning()) {
+    m_drainEvent = Simulator::ScheduleNow(&NetDeviceTransport::drainEgressQueue, this);
+  }
 }
 
 // callback
@@ -132,13 +260,81 @@ NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
 {
   NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
 
-  // Convert NS3 packet to NFD packet
-  Ptr<ns3::Packet> packet = p->Copy();
+  if (packetType == NetDevice::PACKET_OTHERHOST) {
+    // unicast frame to another neighbor, overheard in promiscuous mode; it only counts
+    // towards the load of the channel
+    ++m_nOverheardFrames;
+    m_nOverheardBytes += p->GetSize();
+    return;
+  }
 
+  // Convert NS3 packet to NFD packet. The packet is shared by every receiver of a broadcast
+  // frame, so the header is peeked rather than removed from a copy.
   BlockHeader header;
-  packet->RemoveHeader(header);
+  p->PeekHeader(header);
+
+  nfd::EndpointId endpoint = 0;
+  if (this->getLinkType() != ::ndn::nfd::LINK_TYPE_POINT_TO_POINT) {
+    endpoint = learnNeighbor(from, header.getBlock());
+  }
 
-  this->receive(std::move(header.getBlock()));
+  this->receive(std::move(header.getBlock()), endpoint);
+}
+
+nfd::EndpointId
+NetDeviceTransport::learnNeighbor(const Address& from, const Block& packet)
+{
+  nfd::EndpointId endpoint = makeEndpointId(from);
+  auto now = time::steady_clock::now();
+
+  Neighbor& neighbor = m_neighbors[endpoint];
+  neighbor.address = from;
+  neighbor.lastHeard = now;
+
+  // GeoTag is a header field of the LpPacket. The link service reuses the parsed elements, so
+  // looking it up here does not decode the packet twice.
+  if (packet.type() == ::ndn::lp::tlv::LpPacket) {
+    try {
+      packet.parse();
+      auto geoTag = packet.find(::ndn::lp::tlv::GeoTag);
+      if (geoTag != packet.elements_end()) {
+        ::ndn::lp::GeoTag tag(*geoTag);
+        neighbor.hasPosition = true;
+        neighbor.x = tag.getX();
+        neighbor.y = tag.getY();
+      }
+    }
+    catch (const ::ndn::tlv::Error&) {
+      // malformed packets are reported and dropped by the link service
+    }
+  }
+
+  if (now >= m_nextNeighborCleanup) {
+    for (auto it = m_neighbors.begin(); it != m_neighbors.end();) {
+      if (it->second.lastHeard + m_neighborLifetime <= now) {
+        it = m_neighbors.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+    m_nextNeighborCleanup = now + m_neighborLifetime;
+  }
+
+  return endpoint;
+}
+
+nfd::EndpointId
+NetDeviceTransport::makeEndpointId(const Address& address)
+{
+  uint8_t buffer[Address::MAX_SIZE];
+  uint32_t size = address.CopyTo(buffer);
+
+  nfd::EndpointId endpoint = 0;
+  for (uint32_t i = 0; i < size && i < sizeof(endpoint); ++i) {
+    endpoint = (endpoint << 8) | buffer[i];
+  }
+  return endpoint;
 }
 
 Ptr<NetDevice>
@@ -30,7 +30,13 @@
 #include "ns3/pointer.h"
 
 #include "ns3/point-to-point-net-device.h"
+#include "ns3/queue.h"
 #include "ns3/channel.h"
+#include "ns3/simulator.h"
+
+#include "ndn-priority-egress-queue.hpp"
+
+#include <unordered_map>
 
 namespace ns3 {
 namespace ndn {
@@ -38,10 +44,43 @@ namespace ndn {
 /**
  * \ingroup ndn-face
  * \brief ndnSIM-specific transport
+ *
+ * Unless the link is point-to-point, the transport learns its neighbors from the source address
+ * of received frames and identifies each of them with an EndpointId. Packets sent to a known
+ * neighbor's EndpointId are unicast; all other packets are broadcast.
+ *
+ * On links that are not point-to-point, if the transport can see the NetDevice transmit queue (a
+ * TxQueue attribute, the channel access queue of a WifiNetDevice, or a GeoBroadcastNetDevice),
+ * outgoing packets go through a PriorityEgressQueue and are handed to the device one at a time.
+ * Otherwise, they are handed to the device right away.
  */
 class NetDeviceTransport : public nfd::face::Transport
 {
 public:
+  /**
+   * \brief Neighbor heard on the link
+   */
+  struct Neighbor
+  {
+    Address address;
+    time::steady_clock::TimePoint lastHeard;
+    bool hasPosition = false; ///< \brief whether the neighbor has sent a GeoTag
+    double x = 0.0;
+    double y = 0.0;
+  };
+
+  using NeighborTable = std::unordered_map<nfd::EndpointId, Neighbor>;
+
+  /**
+   * \brief Neighbors not heard for longer than this are forgotten
+   */
+  static const time::nanoseconds DEFAULT_NEIGHBOR_LIFETIME;
+
+  /**
+   * \brief Number of frames the egress queue keeps waiting in the NetDevice queue
+   */
+  static const size_t DEVICE_QUEUE_BUDGET;
+
   NetDeviceTransport(Ptr<Node> node, const Ptr<NetDevice>& netDevice,
                      const std::string& localUri,
                      const std::string& remoteUri,
@@ -57,6 +96,48 @@ public:
   virtual ssize_t
   getSendQueueLength() final;
 
+  const NeighborTable&
+  getNeighbors() const
+  {
+    return m_neighbors;
+  }
+
+  void
+  setNeighborLifetime(time::nanoseconds lifetime)
+  {
+    m_neighborLifetime = lifetime;
+  }
+
+  /**
+   * \brief Get the egress queue, or nullptr if packets are handed to the NetDevice right away
+   */
+  PriorityEgressQueue*
+  getEgressQueue()
+  {
+    return m_egressQueue.get();
+  }
+
+  /**
+   * \brief Number of unicast frames between other nodes heard on the link
+   *
+   * Such frames are not delivered to the link service and therefore are not included in the
+   * transport counters, but they occupy the channel all the same.
+   */
+  uint64_t
+  getNOverheardFrames() const
+  {
+    return m_nOverheardFrames;
+  }
+
+  /**
+   * \brief Number of bytes in the frames counted by getNOverheardFrames
+   */
+  uint64_t
+  getNOverheardBytes() const
+  {
+    return m_nOverheardBytes;
+  }
+
 private:
   virtual void
   doClose() override;
@@ -64,6 +145,34 @@ private:
   virtual void
   doSend(const Block& packet, const nfd::EndpointId& endpoint) override;
 
+  void
+  sendToNetDevice(const Block& packet, const nfd::EndpointId& endpoint);
+
+  /**
+   * \brief Number of frames waiting in the NetDevice queue
+   */
+  size_t
+  getDeviceQueueLength() const;
+
+  /**
+   * \brief Hand packets from the egress queue to the NetDevice, up to DEVICE_QUEUE_BUDGET
+   */
+  void
+  drainEgressQueue();
+
+  void
+  scheduleDrain();
+
+  /**
+   * \brief Called when the device takes a frame from its queue; \p Item is the queue item type
+   */
+  template<typename Item>
+  void
+  onDeviceDequeue(Ptr<const Item>)
+  {
+    scheduleDrain();
+  }
+
   void
   receiveFromNetDevice(Ptr<NetDevice> device,
                        Ptr<const ns3::Packet> p,
@@ -71,8 +180,33 @@ private:
                        const Address& from, const Address& to,
                        NetDevice::PacketType packetType);
 
+  /**
+   * \brief Record a frame received from \p from
+   * \return EndpointId of the neighbor
+   */
+  nfd::EndpointId
+  learnNeighbor(const Address& from, const Block& packet);
+
+  static nfd::EndpointId
+  makeEndpointId(const Address& address);
+
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
   Ptr<Node> m_node;
+
+  NeighborTable m_neighbors;
+  time::nanoseconds m_neighborLifetime;
+  time::steady_clock::TimePoint m_nextNeighborCleanup;
+
+  uint64_t m_nOverheardFrames = 0;
+  uint64_t m_nOverheardBytes = 0;
+
+  Ptr<ns3::QueueBase> m_deviceQueue; ///< \brief transmit queue of the device, if visible
+
+  std::unique_ptr<PriorityEgressQueue> m_egressQueue;
+  Ptr<Object> m_dequeueSource; ///< \brief object whose trace signals that the device took a frame
+  std::string m_dequeueTrace;
+  CallbackBase m_dequeueCallback;
+  EventId m_drainEvent;
 };
 
 } // namespace ndn
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-position-cache.hpp"
+
+#include "ns3/simulator.h"
+
+#include <cmath>
+
+namespace ns3 {
+namespace ndn {
+
+PositionCache::~PositionCache()
+{
+  detach();
+}
+
+void
+PositionCache::attach(Ptr<MobilityModel> mobility)
+{
+  detach();
+  if (mobility == nullptr) {
+    return;
+  }
+
+  m_mobility = mobility;
+  m_mobility->TraceConnectWithoutContext("CourseChange",
+                                         MakeCallback(&PositionCache::onCourseChange, this));
+  onCourseChange(m_mobility);
+}
+
+void
+PositionCache::detach()
+{
+  if (m_mobility == nullptr) {
+    return;
+  }
+
+  m_mobility->TraceDisconnectWithoutContext("CourseChange",
+                                            MakeCallback(&PositionCache::onCourseChange, this));
+  m_mobility = nullptr;
+  m_position = Vector();
+  m_velocity = Vector();
+  m_geoTag = nullptr;
+}
+
+Vector
+PositionCache::getPosition() const
+{
+  double elapsed = (Simulator::Now() - m_updateTime).GetSeconds();
+  return Vector(m_position.x + m_velocity.x * elapsed,
+                m_position.y + m_velocity.y * elapsed,
+                m_position.z + m_velocity.z * elapsed);
+}
+
+shared_ptr<const lp::GeoTag>
+PositionCache::getGeoTag() const
+{
+  Vector position = getPosition();
+  std::pair<int64_t, int64_t> key(std::llround(position.x / lp::GeoTag::POSITION_RESOLUTION),
+                                  std::llround(position.y / lp::GeoTag::POSITION_RESOLUTION));
+  if (m_geoTag == nullptr || key != m_geoTagPosition) {
+    auto geoTag = make_shared<lp::GeoTag>(position.x, position.y);
+    geoTag->wireEncode();
+    m_geoTag = std::move(geoTag);
+    m_geoTagPosition = key;
+  }
+  return m_geoTag;
+}
+
+void
+PositionCache::onCourseChange(Ptr<const MobilityModel> mobility)
+{
+  m_position = mobility->GetPosition();
+  m_velocity = mobility->GetVelocity();
+  m_updateTime = Simulator::Now();
+  m_geoTag = nullptr;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_POSITION_CACHE_HPP
+#define NDN_POSITION_CACHE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+#include "ns3/vector.h"
+
+#include <ndn-cxx/lp/geo-tag.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * \ingroup ndn
+ * \brief Caches the position of a node, refreshed through the MobilityModel CourseChange trace
+ *
+ * On every course change, the cache records the position and velocity of the node. The current
+ * position is then extrapolated from the last record, which is exact for mobility models that
+ * move nodes at constant velocity between course changes (constant velocity, waypoint, random
+ * walk, ns-2 and SUMO traces). Reading the position costs a few arithmetic operations instead of
+ * an aggregate lookup and a virtual call into the mobility model.
+ *
+ * The cache also holds the encoded GeoTag of the node, which every transmission of the node
+ * carries, so that the tag is encoded only when the position it holds changes.
+ */
+class PositionCache : boost::noncopyable
+{
+public:
+  ~PositionCache();
+
+  /**
+   * \brief Start tracking \p mobility
+   */
+  void
+  attach(Ptr<MobilityModel> mobility);
+
+  /**
+   * \brief Stop tracking the mobility model, if any
+   */
+  void
+  detach();
+
+  bool
+  isAttached() const
+  {
+    return m_mobility != nullptr;
+  }
+
+  /**
+   * \brief Get the current position of the node
+   *
+   * Returns the origin if no mobility model is attached.
+   */
+  Vector
+  getPosition() const;
+
+  /**
+   * \brief Get the velocity of the node since the last course change
+   */
+  const Vector&
+  getVelocity() const
+  {
+    return m_velocity;
+  }
+
+  /**
+   * \brief Get a GeoTag holding the current position of the node, with its wire encoding
+   *
+   * The same tag is returned until the position changes at the resolution of the GeoTag or the
+   * node changes course, e.g. to every face of a transmission and to every transmission of a
+   * stationary node.
+   */
+  shared_ptr<const lp::GeoTag>
+  getGeoTag() const;
+
+private:
+  void
+  onCourseChange(Ptr<const MobilityModel> mobility);
+
+private:
+  Ptr<MobilityModel> m_mobility;
+  Vector m_position;
+  Vector m_velocity;
+  Time m_updateTime;
+
+  mutable shared_ptr<const lp::GeoTag> m_geoTag;
+  /// position held by m_geoTag, in units of lp::GeoTag::POSITION_RESOLUTION
+  mutable std::pair<int64_t, int64_t> m_geoTagPosition;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_POSITION_CACHE_HPP
@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-priority-egress-queue.hpp"
+
+#include <ndn-cxx/lp/tlv.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+const size_t PriorityEgressQueue::DEFAULT_LIMIT = 50;
+
+PriorityEgressQueue::PriorityEgressQueue()
+{
+  for (Class& c : m_classes) {
+    c.limit = DEFAULT_LIMIT;
+  }
+}
+
+size_t
+PriorityEgressQueue::classify(const Block& packet)
+{
+  if (packet.type() != ::ndn::lp::tlv::LpPacket) {
+    return N_CLASSES - 1;
+  }
+
+  packet.parse();
+  for (const Block& element : packet.elements()) {
+    if (element.type() == ::ndn::lp::tlv::Priority) {
+      return static_cast<size_t>(std::min<uint64_t>(readNonNegativeInteger(element),
+                                                    N_CLASSES - 1));
+    }
+    // header fields precede the fragment
+    if (element.type() == ::ndn::lp::tlv::Fragment) {
+      break;
+    }
+  }
+  return N_CLASSES - 1;
+}
+
+bool
+PriorityEgressQueue::enqueue(const Block& packet, const nfd::EndpointId& endpoint)
+{
+  Class& c = m_classes[classify(packet)];
+  if (c.queue.size() >= c.limit) {
+    ++c.counters.nDropped;
+    return false;
+  }
+
+  c.queue.push_back(Item{packet, endpoint, time::steady_clock::now()});
+  ++c.counters.nEnqueued;
+  ++m_nPackets;
+  m_nBytes += packet.size();
+  return true;
+}
+
+PriorityEgressQueue::Item
+PriorityEgressQueue::dequeue()
+{
+  BOOST_ASSERT(!empty());
+
+  auto c = std::find_if(m_classes.begin(), m_classes.end(),
+                        [] (const Class& cls) { return !cls.queue.empty(); });
+  Item item = std::move(c->queue.front());
+  c->queue.pop_front();
+  --m_nPackets;
+  m_nBytes -= item.packet.size();
+
+  c->counters.maxDelay = std::max(c->counters.maxDelay,
+                                  time::steady_clock::now() - item.enqueueTime);
+  return item;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_PRIORITY_EGRESS_QUEUE_HPP
+#define NDN_PRIORITY_EGRESS_QUEUE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/face-common.hpp"
+
+#include <array>
+#include <deque>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * \ingroup ndn-face
+ * \brief Strict-priority queue of LpPackets waiting to be handed to a NetDevice
+ *
+ * Packets are classified by the Priority field of their LpPacket header, which the link service
+ * takes from the EgressFields of the transmission or else from lp::PriorityTag; e.g. the denm-geo
+ * strategy sets it to the application type of a DENM. Packets without the field belong to the
+ * least urgent class.
+ * The most urgent non-empty class is always served first, so the queueing delay of a class
+ * depends only on the traffic of the classes at least as urgent, not on background load.
+ *
+ * Each class has its own packet limit; a packet arriving at a full class is dropped and counted.
+ */
+class PriorityEgressQueue : boost::noncopyable
+{
+public:
+  static constexpr size_t N_CLASSES = 4;
+
+  /**
+   * \brief Default limit of every class, in packets
+   */
+  static const size_t DEFAULT_LIMIT;
+
+  struct Item
+  {
+    Block packet;
+    nfd::EndpointId endpoint;
+    time::steady_clock::TimePoint enqueueTime;
+  };
+
+  /**
+   * \brief Counters of one class
+   */
+  struct ClassCounters
+  {
+    uint64_t nEnqueued = 0;
+    uint64_t nDropped = 0;
+    time::nanoseconds maxDelay = time::nanoseconds::zero(); ///< \brief longest queueing delay
+  };
+
+  PriorityEgressQueue();
+
+  /**
+   * \brief Get the class of an LpPacket from its Priority field
+   */
+  static size_t
+  classify(const Block& packet);
+
+  /**
+   * \brief Append \p packet to its class
+   * \return false if the class is full and the packet has been dropped
+   */
+  bool
+  enqueue(const Block& packet, const nfd::EndpointId& endpoint);
+
+  /**
+   * \brief Remove the head of the most urgent non-empty class
+   * \pre !empty()
+   */
+  Item
+  dequeue();
+
+  bool
+  empty() const
+  {
+    return m_nPackets == 0;
+  }
+
+  size_t
+  size() const
+  {
+    return m_nPackets;
+  }
+
+  /**
+   * \brief Number of bytes in all classes
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
+  size_t
+  size(size_t cls) const
+  {
+    return m_classes.at(cls).queue.size();
+  }
+
+  size_t
+  getLimit(size_t cls) const
+  {
+    return m_classes.at(cls).limit;
+  }
+
+  void
+  setLimit(size_t cls, size_t limit)
+  {
+    m_classes.at(cls).limit = limit;
+  }
+
+  const ClassCounters&
+  getCounters(size_t cls) const
+  {
+    return m_classes.at(cls).counters;
+  }
+
+private:
+  struct Class
+  {
+    std::deque<Item> queue;
+    size_t limit;
+    ClassCounters counters;
+  };
+
+  std::array<Class, N_CLASSES> m_classes;
+  size_t m_nPackets = 0;
+  size_t m_nBytes = 0;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_PRIORITY_EGRESS_QUEUE_HPP
@@ -24,6 +24,7 @@
 #include "ns3/ndnSIM/helper/ndn-app-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-global-routing-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-network-region-table-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-geo-broadcast-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-ip-faces-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-link-control-helper.hpp"
 
@@ -33,9 +34,13 @@
 #include "ns3/ndnSIM/utils/tracers/l2-rate-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-app-delay-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-cs-tracer.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-denm-trace.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-denm-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-l3-rate-tracer.hpp"
 
 // #include "ns3/ndnSIM/model/ndn-app-face.hpp"
+#include "ns3/ndnSIM/model/ndn-geo-broadcast-channel.hpp"
+#include "ns3/ndnSIM/model/ndn-geo-broadcast-net-device.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 // #include "ns3/ndnSIM/model/ndn-net-device-face.hpp"
 
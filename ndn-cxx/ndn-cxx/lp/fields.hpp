@@ -128,6 +128,14 @@ typedef FieldDecl<field_location_tags::Header,
                   tlv::GeoTag> GeoTagField;
 BOOST_CONCEPT_ASSERT((Field<GeoTagField>));
 
+typedef FieldDecl<field_location_tags::Header,
+                  uint64_t,
+                  tlv::Priority,
+                  false,
+                  NonNegativeIntegerTag,
+                  NonNegativeIntegerTag> PriorityField;
+BOOST_CONCEPT_ASSERT((Field<PriorityField>));
+
 /** \brief Declare the Fragment field.
  *
  *  The fragment (i.e. payload) is the bytes between two provided iterators. During encoding,
@@ -156,7 +164,8 @@ typedef boost::mpl::set<
   NonDiscoveryField,
   PrefixAnnouncementField,
   HopCountTagField,
-  GeoTagField
+  GeoTagField,
+  PriorityField
   > FieldSet;
 
 } // namespace lp
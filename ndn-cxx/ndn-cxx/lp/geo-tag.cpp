@@ -22,9 +22,55 @@
 #include "ndn-cxx/lp/geo-tag.hpp"
 #include "ndn-cxx/lp/tlv.hpp"
 
+#include <boost/endian/conversion.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
 namespace ndn {
 namespace lp {
 
+constexpr double GeoTag::POSITION_RESOLUTION;
+
+static int32_t
+toFixedPoint(double coordinate)
+{
+  double value = std::round(coordinate / GeoTag::POSITION_RESOLUTION);
+  if (!(value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max())) {
+    NDN_THROW(std::invalid_argument("GeoTag coordinate " + to_string(coordinate) + " is out of range"));
+  }
+  return static_cast<int32_t>(value);
+}
+
+template<typename T, encoding::Tag TAG>
+static size_t
+prependFixed(EncodingImpl<TAG>& encoder, T value)
+{
+  value = boost::endian::native_to_big(value);
+  return encoder.prependByteArray(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+}
+
+template<typename T>
+static T
+readFixed(const uint8_t*& pos)
+{
+  T value;
+  std::memcpy(&value, pos, sizeof(value));
+  pos += sizeof(value);
+  return boost::endian::big_to_native(value);
+}
+
+GeoTag::GeoTag(double x, double y)
+{
+  setPos(x, y);
+}
+
+GeoTag::GeoTag(std::tuple<double, double, double> pos)
+{
+  setPos(pos);
+}
+
 GeoTag::GeoTag(const Block& block)
 {
   wireDecode(block);
@@ -34,10 +80,21 @@ template<encoding::Tag TAG>
 size_t
 GeoTag::wireEncode(EncodingImpl<TAG>& encoder) const
 {
+  if (m_wire.hasWire()) {
+    return encoder.prependBlock(m_wire);
+  }
+
   size_t length = 0;
-  length += prependDoubleBlock(encoder, tlv::GeoTagPos, std::get<2>(m_pos));
-  length += prependDoubleBlock(encoder, tlv::GeoTagPos, std::get<1>(m_pos));
-  length += prependDoubleBlock(encoder, tlv::GeoTagPos, std::get<0>(m_pos));
+  if (hasMotion()) {
+    length += prependFixed(encoder, m_speed);
+    length += prependFixed(encoder, m_heading);
+  }
+  if (hasZ()) {
+    length += prependFixed(encoder, m_z);
+  }
+  length += prependFixed(encoder, m_y);
+  length += prependFixed(encoder, m_x);
+  length += encoder.prependByte(m_flags);
   length += encoder.prependVarNumber(length);
   length += encoder.prependVarNumber(tlv::GeoTag);
   return length;
@@ -71,21 +128,82 @@ void
 GeoTag::wireDecode(const Block& wire)
 {
   if (wire.type() != tlv::GeoTag) {
-    NDN_THROW(ndn::tlv::Error("expecting GeoTag block"));
+    NDN_THROW(Error("expecting GeoTag block"));
+  }
+  if (wire.value_size() < 1) {
+    NDN_THROW(Error("GeoTag is empty"));
   }
 
+  const uint8_t* pos = wire.value();
+  uint8_t flags = *pos++;
+  size_t expectedSize = 1 + 2 * sizeof(int32_t);
+  if (flags & FLAG_HAS_Z) {
+    expectedSize += sizeof(int32_t);
+  }
+  if (flags & FLAG_HAS_MOTION) {
+    expectedSize += 2 * sizeof(uint16_t);
+  }
+  if (wire.value_size() != expectedSize) {
+    NDN_THROW(Error("GeoTag has " + to_string(wire.value_size()) + " octets, expecting " +
+                    to_string(expectedSize)));
+  }
+
+  m_flags = flags;
+  m_x = readFixed<int32_t>(pos);
+  m_y = readFixed<int32_t>(pos);
+  m_z = hasZ() ? readFixed<int32_t>(pos) : 0;
+  m_heading = hasMotion() ? readFixed<uint16_t>(pos) : 0;
+  m_speed = hasMotion() ? readFixed<uint16_t>(pos) : 0;
+
   m_wire = wire;
-  m_wire.parse();
+}
 
-  if (m_wire.elements().size() < 3 ||
-      m_wire.elements()[0].type() != tlv::GeoTagPos ||
-      m_wire.elements()[1].type() != tlv::GeoTagPos ||
-      m_wire.elements()[2].type() != tlv::GeoTagPos) {
-    NDN_THROW(ndn::tlv::Error("Unexpected input while decoding GeoTag"));
+GeoTag&
+GeoTag::setPos(double x, double y)
+{
+  m_x = toFixedPoint(x);
+  m_y = toFixedPoint(y);
+  m_z = 0;
+  m_flags &= ~FLAG_HAS_Z;
+  m_wire.reset();
+  return *this;
+}
+
+GeoTag&
+GeoTag::setPos(std::tuple<double, double, double> pos)
+{
+  setPos(std::get<0>(pos), std::get<1>(pos));
+  m_z = toFixedPoint(std::get<2>(pos));
+  m_flags |= FLAG_HAS_Z;
+  return *this;
+}
+
+GeoTag&
+GeoTag::setMotion(double heading, double speed)
+{
+  if (!(speed >= 0.0 && speed <= std::numeric_limits<uint16_t>::max() * 0.01)) {
+    NDN_THROW(std::invalid_argument("GeoTag speed " + to_string(speed) + " is out of range"));
   }
-  m_pos = {encoding::readDouble(m_wire.elements()[0]),
-           encoding::readDouble(m_wire.elements()[1]),
-           encoding::readDouble(m_wire.elements()[2])};
+
+  heading = std::fmod(heading, 360.0);
+  if (heading < 0.0) {
+    heading += 360.0;
+  }
+  m_heading = static_cast<uint16_t>(std::lround(heading * 100.0) % 36000);
+  m_speed = static_cast<uint16_t>(std::lround(speed * 100.0));
+  m_flags |= FLAG_HAS_MOTION;
+  m_wire.reset();
+  return *this;
+}
+
+GeoTag&
+GeoTag::unsetMotion()
+{
+  m_heading = 0;
+  m_speed = 0;
+  m_flags &= ~FLAG_HAS_MOTION;
+  m_wire.reset();
+  return *this;
 }
 
 } // namespace lp
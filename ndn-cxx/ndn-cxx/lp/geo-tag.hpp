@@ -31,29 +31,54 @@ namespace lp {
 
 /**
  * \brief represents a GeoTag header field
+ *
+ * GeoTag carries the position of the node that transmitted the packet on the last hop, and
+ * optionally its heading and speed. Coordinates are encoded as 32-bit fixed-point numbers with
+ * a resolution of 1 cm, so a two-dimensional GeoTag takes 11 octets on the wire:
+ *
+ *     GeoTag = GEO-TAG-TYPE TLV-LENGTH
+ *                Flags           ; 1 octet: 0x01 Z is present, 0x02 Heading and Speed are present
+ *                X Y             ; 4 octets each, signed, centimeters
+ *                [Z]             ; 4 octets, signed, centimeters
+ *                [Heading Speed] ; 2 octets each, 0.01 degree and cm/s
  */
 class GeoTag : public Tag
 {
 public:
+  class Error : public ndn::tlv::Error
+  {
+  public:
+    using ndn::tlv::Error::Error;
+  };
+
   static constexpr int
   getTypeId() noexcept
   {
     return 0x60000001;
   }
 
+  /**
+   * \brief resolution of encoded coordinates, in meters
+   */
+  static constexpr double POSITION_RESOLUTION = 0.01;
+
   GeoTag() = default;
 
+  GeoTag(double x, double y);
+
+  /**
+   * \brief create a three-dimensional GeoTag
+   */
   explicit
-  GeoTag(std::tuple<double, double, double> pos)
-    : m_pos(pos)
-  {
-  }
+  GeoTag(std::tuple<double, double, double> pos);
 
   explicit
   GeoTag(const Block& block);
 
   /**
    * \brief prepend GeoTag to encoder
+   *
+   * The cached wire encoding is reused when available.
    */
   template<encoding::Tag TAG>
   size_t
@@ -72,31 +97,107 @@ public:
   wireDecode(const Block& wire);
 
 public: // get & set GeoTag
+  double
+  getX() const
+  {
+    return m_x * POSITION_RESOLUTION;
+  }
+
+  double
+  getY() const
+  {
+    return m_y * POSITION_RESOLUTION;
+  }
+
+  bool
+  hasZ() const
+  {
+    return m_flags & FLAG_HAS_Z;
+  }
+
+  /**
+   * \return position z, or 0.0 if unset
+   */
+  double
+  getZ() const
+  {
+    return m_z * POSITION_RESOLUTION;
+  }
+
   /**
-   * \return position x of GeoTag
+   * \return position as (x, y, z); z is 0.0 if unset
    */
   std::tuple<double, double, double>
   getPos() const
   {
-    return m_pos;
+    return std::make_tuple(getX(), getY(), getZ());
+  }
+
+  /**
+   * \brief set position x and y, and unset z
+   * \throw std::invalid_argument a coordinate is not representable
+   */
+  GeoTag&
+  setPos(double x, double y);
+
+  /**
+   * \brief set position x, y and z
+   * \throw std::invalid_argument a coordinate is not representable
+   */
+  GeoTag&
+  setPos(std::tuple<double, double, double> pos);
+
+  bool
+  hasMotion() const
+  {
+    return m_flags & FLAG_HAS_MOTION;
   }
 
   /**
-   * \brief set position x
+   * \return heading in degrees within [0, 360), or 0.0 if unset
    */
-  GeoTag*
-  setPosX(std::tuple<double, double, double> pos)
+  double
+  getHeading() const
   {
-    m_pos = pos;
-    return this;
+    return m_heading * 0.01;
   }
 
+  /**
+   * \return speed in m/s, or 0.0 if unset
+   */
+  double
+  getSpeed() const
+  {
+    return m_speed * 0.01;
+  }
+
+  /**
+   * \brief set heading in degrees and speed in m/s
+   * \throw std::invalid_argument speed is negative or above 655.35 m/s
+   */
+  GeoTag&
+  setMotion(double heading, double speed);
+
+  GeoTag&
+  unsetMotion();
+
 private:
-  std::tuple<double, double, double> m_pos = {0.0, 0.0, 0.0};
+  enum : uint8_t {
+    FLAG_HAS_Z = 0x01,
+    FLAG_HAS_MOTION = 0x02,
+  };
+
+  uint8_t m_flags = 0;
+  int32_t m_x = 0;
+  int32_t m_y = 0;
+  int32_t m_z = 0;
+  uint16_t m_heading = 0;
+  uint16_t m_speed = 0;
+
   mutable Block m_wire;
 };
 
 } // namespace lp
 } // namespace ndn
 
-#endif // NDN_CXX_LP_GEOTAG_HPP
+#endif // NDN_CXX_LP_GEO_TAG_HPP
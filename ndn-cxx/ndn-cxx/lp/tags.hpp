@@ -87,6 +87,13 @@ typedef SimpleTag<uint64_t, 0x60000000> HopCountTag;
  */
 class GeoTag; // 0x60000001, defined directly in geo-tag.hpp
 
+/** \class PriorityTag
+ *  \brief a packet tag for Priority field
+ *
+ *  Smaller values are more urgent. This tag can be attached to Interest, Data, Nack.
+ */
+typedef SimpleTag<uint64_t, 0x60000002> PriorityTag;
+
 } // namespace lp
 } // namespace ndn
 
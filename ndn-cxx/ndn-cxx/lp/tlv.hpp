@@ -37,7 +37,7 @@ enum {
   FragCount = 83,
   HopCountTag = 84,
   GeoTag = 85,
-  GeoTagPos = 85, // inner fields inside GeoTag
+  Priority = 86,
   PitToken = 98,
   Nack = 800,
   NackReason = 801,
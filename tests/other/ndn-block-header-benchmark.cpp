@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/ndn-block-header.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+
+#include <boost/iostreams/concepts.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include <chrono>
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Microbenchmark of the receive path of NetDeviceTransport.
+ *
+ * Every receiver of a broadcast frame turns the ns-3 packet back into an NDNLP block. This
+ * benchmark measures that conversion for LpPackets carrying Data of several payload sizes:
+ *
+ * - stream: copy the packet, then remove a header that reads the packet byte by byte through
+ *   a boost::iostreams source into Block::fromStream (the former BlockHeader implementation)
+ * - peek: peek BlockHeader, which reads TLV-TYPE and TLV-LENGTH and copies the element into
+ *   one buffer in a single pass
+ *
+ *     ./waf --run="ndn-block-header-benchmark --iterations=1000000"
+ */
+
+namespace io = boost::iostreams;
+
+class StreamSource : public io::source
+{
+public:
+  StreamSource(Buffer::Iterator& is)
+    : m_is(is)
+  {
+  }
+
+  std::streamsize
+  read(char* buf, std::streamsize nMaxRead)
+  {
+    std::streamsize i = 0;
+    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
+      buf[i] = m_is.ReadU8();
+    }
+    return i == 0 ? -1 : i;
+  }
+
+private:
+  Buffer::Iterator& m_is;
+};
+
+class StreamBlockHeader : public ndn::BlockHeader
+{
+public:
+  uint32_t
+  Deserialize(Buffer::Iterator start) override
+  {
+    io::stream<StreamSource> is(start);
+    getBlock() = ::ndn::Block::fromStream(is);
+    return getBlock().size();
+  }
+};
+
+static Ptr<Packet>
+MakeFrame(size_t payloadSize)
+{
+  auto data = std::make_shared<::ndn::Data>(::ndn::Name("/denm/benchmark").appendSequenceNumber(1));
+  data->setContent(std::make_shared<::ndn::Buffer>(payloadSize));
+  data->setSignature(::ndn::Signature(::ndn::SignatureInfo(::ndn::tlv::DigestSha256)));
+  data->setSignatureValue(::ndn::encoding::makeEmptyBlock(::ndn::tlv::SignatureValue));
+
+  ::ndn::lp::Packet lpPacket(data->wireEncode());
+  lpPacket.add<::ndn::lp::GeoTagField>(::ndn::lp::GeoTag(1234.5, 678.9));
+
+  Ptr<Packet> packet = Create<Packet>();
+  packet->AddHeader(ndn::BlockHeader(lpPacket.wireEncode()));
+  return packet;
+}
+
+template<typename F>
+static double
+MeasureNsPerFrame(uint32_t nIterations, const F& receive)
+{
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < nIterations; ++i) {
+    receive();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+  return elapsed.count() / nIterations;
+}
+
+int
+main(int argc, char* argv[])
+{
+  uint32_t nIterations = 100000;
+
+  CommandLine cmd;
+  cmd.AddValue("iterations", "Number of frames received for each payload size and method",
+               nIterations);
+  cmd.Parse(argc, argv);
+
+  std::cout << "PayloadSize\tFrameSize\tStreamNS\tPeekNS\tSpeedup\n";
+  for (size_t payloadSize : {100, 300, 1000, 1400}) {
+    Ptr<const Packet> frame = MakeFrame(payloadSize);
+    size_t checksum = 0;
+
+    double streamNs = MeasureNsPerFrame(nIterations, [&] {
+      Ptr<Packet> packet = frame->Copy();
+      StreamBlockHeader header;
+      packet->RemoveHeader(header);
+      checksum += header.getBlock().size();
+    });
+
+    double peekNs = MeasureNsPerFrame(nIterations, [&] {
+      ndn::BlockHeader header;
+      frame->PeekHeader(header);
+      checksum += header.getBlock().size();
+    });
+
+    NS_ABORT_MSG_UNLESS(checksum == 2 * nIterations * frame->GetSize(), "frame was not decoded");
+    std::cout << payloadSize << "\t" << frame->GetSize() << "\t" << streamNs << "\t" << peekNs
+              << "\t" << streamNs / peekNs << "\n";
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
@@ -0,0 +1,373 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/mobility-module.h"
+
+#include "ns3/ndnSIM-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+namespace ns3 {
+
+/// whether heap allocations are being counted, i.e. while the simulation runs
+static bool g_isCountingAllocations = false;
+static uint64_t g_nAllocations = 0;
+
+} // namespace ns3
+
+void*
+operator new(std::size_t size)
+{
+  if (ns3::g_isCountingAllocations) {
+    ++ns3::g_nAllocations;
+  }
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("ndn.DenmBenchmark");
+
+/**
+ * Benchmark of DENM dissemination on synthetic vehicular topologies.
+ *
+ * Vehicles are placed on one of three synthetic road layouts, with a density that does not
+ * depend on the number of vehicles, so larger runs cover a larger area:
+ *
+ * - highway: a straight road with three lanes per direction, vehicles at 25-35 m/s
+ * - grid: a Manhattan grid with 200 m blocks, vehicles driving along the streets at 10-15 m/s
+ * - urban: a dense area with random-walk vehicles at 3-14 m/s
+ *
+ * A fraction of the vehicles run a DENM producer. All vehicles share one 802.11a ad-hoc channel
+ * with a 250 m range and use the denm-geo strategy for /denm.
+ *
+ * At the end of the run a single JSON object is written. It holds wall-clock time, simulated
+ * seconds per wall-clock second, peak RSS (sampled every simulated second), ns-3 events processed,
+ * heap allocations made while the simulation runs, in total and per forwarded Data, forwarder
+ * packet counters, and per-table sizes (total over all nodes and largest single node).
+ * Appending these lines to a file gives a record that can be compared between releases;
+ * ndn-denm-benchmark.sh runs the whole suite: each topology at 100, 1k, 5k and 10k vehicles.
+ */
+
+static void
+SampleMemory(Time period, int64_t* peakRss)
+{
+  *peakRss = std::max(*peakRss, MemUsage::Get());
+  Simulator::Schedule(period, &SampleMemory, period, peakRss);
+}
+
+static void
+PlaceHighway(NodeContainer& vehicles, Ptr<UniformRandomVariable> rand)
+{
+  const int N_LANES = 6; // three per direction
+  const double LANE_WIDTH = 4.0;
+  const double SPACING = 30.0; // average distance between vehicles on a lane
+  double length = std::max(1.0, std::ceil(vehicles.GetN() / static_cast<double>(N_LANES))) * SPACING;
+
+  MobilityHelper mobility;
+  mobility.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+  mobility.Install(vehicles);
+
+  for (uint32_t i = 0; i < vehicles.GetN(); ++i) {
+    int lane = i % N_LANES;
+    double direction = lane < N_LANES / 2 ? 1.0 : -1.0;
+    Ptr<ConstantVelocityMobilityModel> model =
+      vehicles.Get(i)->GetObject<ConstantVelocityMobilityModel>();
+    model->SetPosition(Vector(rand->GetValue(0, length), lane * LANE_WIDTH, 0));
+    model->SetVelocity(Vector(direction * rand->GetValue(25, 35), 0, 0));
+  }
+}
+
+static void
+PlaceGrid(NodeContainer& vehicles, Ptr<UniformRandomVariable> rand)
+{
+  const double BLOCK = 200.0;
+  const double VEHICLES_PER_BLOCK = 8.0; // on each street segment
+  // a grid of k x k blocks has about 2k(k+1) street segments
+  uint32_t k = std::max(1u, static_cast<uint32_t>(std::ceil(
+    std::sqrt(vehicles.GetN() / (2 * VEHICLES_PER_BLOCK)))));
+  double side = k * BLOCK;
+
+  MobilityHelper mobility;
+  mobility.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+  mobility.Install(vehicles);
+
+  for (uint32_t i = 0; i < vehicles.GetN(); ++i) {
+    double street = rand->GetInteger(0, k) * BLOCK;
+    double along = rand->GetValue(0, side);
+    double speed = rand->GetValue(10, 15) * (rand->GetValue() < 0.5 ? -1 : 1);
+    Ptr<ConstantVelocityMobilityModel> model =
+      vehicles.Get(i)->GetObject<ConstantVelocityMobilityModel>();
+    if (i % 2 == 0) { // horizontal street
+      model->SetPosition(Vector(along, street, 0));
+      model->SetVelocity(Vector(speed, 0, 0));
+    }
+    else { // vertical street
+      model->SetPosition(Vector(street, along, 0));
+      model->SetVelocity(Vector(0, speed, 0));
+    }
+  }
+}
+
+static void
+PlaceUrban(NodeContainer& vehicles, Ptr<UniformRandomVariable> rand)
+{
+  const double AREA_PER_VEHICLE = 2500.0; // square meters
+  double side = std::sqrt(vehicles.GetN() * AREA_PER_VEHICLE);
+
+  Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator>();
+  for (uint32_t i = 0; i < vehicles.GetN(); ++i) {
+    positions->Add(Vector(rand->GetValue(0, side), rand->GetValue(0, side), 0));
+  }
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator(positions);
+  mobility.SetMobilityModel("ns3::RandomWalk2dMobilityModel",
+                            "Bounds", RectangleValue(Rectangle(0, side, 0, side)),
+                            "Mode", StringValue("Distance"),
+                            "Distance", DoubleValue(100),
+                            "Speed", StringValue("ns3::UniformRandomVariable[Min=3|Max=14]"));
+  mobility.Install(vehicles);
+}
+
+static void
+InstallWifi(NodeContainer& vehicles)
+{
+  WifiHelper wifi;
+  wifi.SetStandard(WIFI_PHY_STANDARD_80211a);
+  wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                               "DataMode", StringValue("OfdmRate6Mbps"),
+                               "NonUnicastMode", StringValue("OfdmRate6Mbps"));
+
+  YansWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss("ns3::RangePropagationLossModel", "MaxRange", DoubleValue(250));
+
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default();
+  wifiPhy.SetChannel(wifiChannel.Create());
+
+  WifiMacHelper wifiMac;
+  wifiMac.SetType("ns3::AdhocWifiMac");
+
+  wifi.Install(wifiPhy, wifiMac, vehicles);
+}
+
+struct TableSize
+{
+  void
+  add(size_t size)
+  {
+    total += size;
+    max = std::max<uint64_t>(max, size);
+  }
+
+  uint64_t total = 0;
+  uint64_t max = 0;
+};
+
+static std::ostream&
+operator<<(std::ostream& os, const TableSize& size)
+{
+  return os << "{\"total\":" << size.total << ",\"max\":" << size.max << "}";
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::string topology = "highway";
+  uint32_t nVehicles = 100;
+  double producerRatio = 0.01;
+  double duration = 10.0;
+  double interval = 100.0;
+  uint32_t payloadSize = 300;
+  std::string output = "-";
+
+  CommandLine cmd;
+  cmd.AddValue("topology", "Road layout: highway, grid or urban", topology);
+  cmd.AddValue("vehicles", "Number of vehicles", nVehicles);
+  cmd.AddValue("producers", "Fraction of vehicles that produce DENMs", producerRatio);
+  cmd.AddValue("duration", "Simulated time, in seconds", duration);
+  cmd.AddValue("interval", "Interval between DENMs of a producer, in milliseconds", interval);
+  cmd.AddValue("payload", "DENM payload size, in bytes", payloadSize);
+  cmd.AddValue("output", "File to which the JSON result is appended, - for standard output",
+               output);
+  cmd.Parse(argc, argv);
+
+  int64_t rssBefore = MemUsage::Get();
+  auto setupStart = std::chrono::steady_clock::now();
+
+  NodeContainer vehicles;
+  vehicles.Create(nVehicles);
+
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable>();
+  if (topology == "highway") {
+    PlaceHighway(vehicles, rand);
+  }
+  else if (topology == "grid") {
+    PlaceGrid(vehicles, rand);
+  }
+  else if (topology == "urban") {
+    PlaceUrban(vehicles, rand);
+  }
+  else {
+    NS_FATAL_ERROR("Unknown topology " << topology << ", expected highway, grid or urban");
+  }
+
+  InstallWifi(vehicles);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.Install(vehicles);
+  ndn::StrategyChoiceHelper::Install(vehicles, "/", "/localhost/nfd/strategy/multicast");
+  ndn::StrategyChoiceHelper::Install(vehicles, "/denm", "/localhost/nfd/strategy/denm-geo");
+
+  uint32_t nProducers = std::max(1u, static_cast<uint32_t>(std::round(nVehicles * producerRatio)));
+  uint32_t stride = std::max(1u, nVehicles / nProducers);
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/denm");
+  producerHelper.SetAttribute("AdvTransmissionInterval", DoubleValue(interval));
+  producerHelper.SetAttribute("PayloadSize", UintegerValue(payloadSize));
+  for (uint32_t i = 0; i < nProducers; ++i) {
+    ApplicationContainer app = producerHelper.Install(vehicles.Get((i * stride) % nVehicles));
+    app.Start(Seconds(rand->GetValue(0, 1)));
+  }
+
+  int64_t peakRss = MemUsage::Get();
+  Simulator::Schedule(Seconds(1), &SampleMemory, Seconds(1), &peakRss);
+  Simulator::Stop(Seconds(duration));
+
+  auto runStart = std::chrono::steady_clock::now();
+  uint64_t eventsBefore = Simulator::GetEventCount();
+  g_isCountingAllocations = true;
+  Simulator::Run();
+  g_isCountingAllocations = false;
+  uint64_t nEvents = Simulator::GetEventCount() - eventsBefore;
+  auto runEnd = std::chrono::steady_clock::now();
+  peakRss = std::max(peakRss, MemUsage::Get());
+
+  double setupWall = std::chrono::duration<double>(runStart - setupStart).count();
+  double runWall = std::chrono::duration<double>(runEnd - runStart).count();
+
+  TableSize pit, cs, fib, deadNonces, pendingRebroadcasts, deadDenms, timers;
+  uint64_t nInInterests = 0, nInData = 0, nOutData = 0;
+  uint64_t nRebroadcastsScheduled = 0, nRebroadcastsSuppressed = 0;
+  uint64_t nTimerTicks = 0, nTimersFired = 0;
+  for (NodeContainer::Iterator node = vehicles.Begin(); node != vehicles.End(); ++node) {
+    nfd::Forwarder& forwarder = *ndn::L3Protocol::getL3Protocol(*node)->getForwarder();
+    pit.add(forwarder.getPit().size());
+    cs.add(forwarder.getCs().size());
+    fib.add(forwarder.getFib().size());
+    deadNonces.add(forwarder.getDeadNonceList().size());
+    pendingRebroadcasts.add(forwarder.getPendingRebroadcastTable().size());
+    deadDenms.add(forwarder.getDeadDenmList().size());
+    timers.add(forwarder.getTimerWheel().size());
+
+    const nfd::ForwarderCounters& counters = forwarder.getCounters();
+    nInInterests += counters.nInInterests;
+    nInData += counters.nInData;
+    nOutData += counters.nOutData;
+    nRebroadcastsScheduled += counters.nRebroadcastsScheduled;
+    nRebroadcastsSuppressed += counters.nRebroadcastsSuppressed;
+    nTimerTicks += forwarder.getTimerWheel().getCounters().nTicks;
+    nTimersFired += forwarder.getTimerWheel().getCounters().nFired;
+  }
+
+  std::ofstream file;
+  if (output != "-") {
+    file.open(output.c_str(), std::ios_base::out | std::ios_base::app);
+    if (!file.is_open()) {
+      NS_FATAL_ERROR("File " << output << " cannot be opened for writing");
+    }
+  }
+  std::ostream& os = output == "-" ? std::cout : file;
+
+  os << "{\"topology\":\"" << topology << "\""
+     << ",\"vehicles\":" << nVehicles
+     << ",\"producers\":" << nProducers
+     << ",\"duration\":" << duration
+     << ",\"interval\":" << interval
+     << ",\"payload\":" << payloadSize
+     << ",\"run\":" << RngSeedManager::GetRun()
+     << ",\"setupWallSeconds\":" << setupWall
+     << ",\"runWallSeconds\":" << runWall
+     << ",\"simSecondsPerWallSecond\":" << (runWall > 0 ? duration / runWall : 0.0)
+     << ",\"rssBeforeBytes\":" << rssBefore
+     << ",\"peakRssBytes\":" << peakRss
+     << ",\"events\":" << nEvents
+     << ",\"eventsPerWallSecond\":" << (runWall > 0 ? nEvents / runWall : 0.0)
+     << ",\"allocations\":" << g_nAllocations
+     << ",\"allocationsPerOutData\":"
+     << (nOutData > 0 ? static_cast<double>(g_nAllocations) / nOutData : 0.0)
+     << ",\"inInterests\":" << nInInterests
+     << ",\"inData\":" << nInData
+     << ",\"outData\":" << nOutData
+     << ",\"inDataPerWallSecond\":" << (runWall > 0 ? nInData / runWall : 0.0)
+     << ",\"rebroadcastsScheduled\":" << nRebroadcastsScheduled
+     << ",\"rebroadcastsSuppressed\":" << nRebroadcastsSuppressed
+     << ",\"timerWheelTicks\":" << nTimerTicks
+     << ",\"timersFired\":" << nTimersFired
+     << ",\"tables\":{"
+     << "\"pit\":" << pit
+     << ",\"cs\":" << cs
+     << ",\"fib\":" << fib
+     << ",\"deadNonceList\":" << deadNonces
+     << ",\"pendingRebroadcasts\":" << pendingRebroadcasts
+     << ",\"deadDenmList\":" << deadDenms
+     << ",\"timerWheel\":" << timers
+     << "}}" << std::endl;
+
+  Simulator::Destroy();
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
@@ -0,0 +1,16 @@
+#!/bin/bash
+
+# Runs the DENM benchmark suite and appends one JSON object per scenario to the output file,
+# so that results of different releases can be compared line by line.
+
+output=${1:-denm-benchmark.jsonl}
+duration=${DURATION:-10}
+payload=${PAYLOAD:-300}
+
+for topology in highway grid urban; do
+  for vehicles in 100 1000 5000 10000; do
+    echo "topology = " $topology, "vehicles = " $vehicles
+
+    ../../../waf --run ndn-denm-benchmark --command-template="%s --topology=${topology} --vehicles=${vehicles} --duration=${duration} --payload=${payload} --output=${output}"
+  done
+done
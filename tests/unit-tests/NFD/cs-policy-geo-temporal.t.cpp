@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs-policy-geo-temporal.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+#include "ns3/ndnSIM/model/ndn-position-cache.hpp"
+#include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
+
+#include "ns3/constant-velocity-mobility-model.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::fw::DenmName;
+
+class GeoTemporalPolicyFixture : public CleanupFixture
+{
+public:
+  GeoTemporalPolicyFixture()
+  {
+    scopeTable.setDefault({1000.0, time::seconds(10)});
+
+    auto policy = make_unique<::nfd::cs::GeoTemporalPolicy>();
+    this->policy = policy.get();
+    cs.setPolicy(std::move(policy));
+    cs.setLimit(2);
+  }
+
+  shared_ptr<Data>
+  makeDenm(double eventX, double eventY, time::milliseconds age, uint64_t sequence)
+  {
+    DenmName denm;
+    denm.eventX = eventX;
+    denm.eventY = eventY;
+    denm.eventTime = time::duration_cast<time::milliseconds>(
+                       time::steady_clock::now().time_since_epoch()) - age;
+    denm.referenceTime = denm.eventTime;
+    denm.sequence = sequence;
+
+    auto data = make_shared<Data>(denm.toName());
+    StackHelper::getKeyChain().sign(*data);
+    return data;
+  }
+
+  bool
+  isCached(const Data& data)
+  {
+    bool isHit = false;
+    cs.find(Interest(data.getName()),
+            [&] (const Interest&, const Data&) { isHit = true; },
+            [] (const Interest&) {});
+    return isHit;
+  }
+
+public:
+  ::nfd::DenmScopeTable scopeTable;
+  ::nfd::cs::Cs cs;
+  ::nfd::cs::GeoTemporalPolicy* policy;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestCsPolicyGeoTemporal, GeoTemporalPolicyFixture)
+
+BOOST_AUTO_TEST_CASE(TemporalValidity)
+{
+  policy->setContext(scopeTable, nullptr);
+
+  auto expired = makeDenm(0, 0, time::seconds(11), 1);
+  auto older = makeDenm(0, 0, time::seconds(9), 2);
+  auto newer = makeDenm(0, 0, time::seconds(5), 3);
+  cs.insert(*expired, true);
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+  BOOST_CHECK_EQUAL(policy->getNRejected(), 1);
+
+  cs.insert(*older, true);
+  cs.insert(*newer, true);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  // the older DENM expires after 1s and the newer after 5s, without any further insertion
+  Simulator::Schedule(MilliSeconds(1500), MakeEvent([&] {
+    BOOST_CHECK_EQUAL(cs.size(), 1);
+    BOOST_CHECK(!isCached(*older));
+    BOOST_CHECK(isCached(*newer));
+  }));
+
+  Simulator::Stop(Seconds(6));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+  BOOST_CHECK_EQUAL(policy->getNExpired(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(DistanceAndHeading)
+{
+  // the node drives along the x axis at 100 m/s
+  auto mobility = CreateObject<ConstantVelocityMobilityModel>();
+  mobility->SetPosition(Vector(0, 0, 0));
+  mobility->SetVelocity(Vector(100, 0, 0));
+  PositionCache positionCache;
+  positionCache.attach(mobility);
+  policy->setContext(scopeTable, &positionCache);
+
+  auto far = makeDenm(5000, 0, time::seconds(0), 1);
+  cs.insert(*far, true);
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+  BOOST_CHECK_EQUAL(policy->getNRejected(), 1);
+
+  // the node leaves the range of the event behind it within 1s,
+  // but stays in range of the events ahead until they expire
+  auto behind = makeDenm(-900, 0, time::seconds(0), 2);
+  auto ahead = makeDenm(500, 0, time::seconds(0), 3);
+  auto aheadAndOlder = makeDenm(500, 100, time::seconds(5), 4);
+  cs.insert(*behind, true);
+  cs.insert(*ahead, true);
+  cs.insert(*aheadAndOlder, true);
+
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK(!isCached(*behind));
+  BOOST_CHECK(isCached(*ahead));
+  BOOST_CHECK(isCached(*aheadAndOlder));
+
+  // a non-DENM Data that is already stale goes first
+  Data other("/other");
+  StackHelper::getKeyChain().sign(other);
+  cs.insert(other, true);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK(!isCached(other));
+  BOOST_CHECK(isCached(*ahead));
+  BOOST_CHECK(isCached(*aheadAndOlder));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/dead-denm-list.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pending-rebroadcast-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestDeadDenmList, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(AddRemove)
+{
+  ::nfd::DeadDenmList list(time::seconds(1), 1024);
+  auto keyA = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/A");
+  auto keyB = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/B");
+
+  BOOST_CHECK_EQUAL(list.has(keyA), false);
+  list.add(keyA);
+  BOOST_CHECK_EQUAL(list.has(keyA), true);
+  BOOST_CHECK_EQUAL(list.has(keyB), false);
+  BOOST_CHECK_EQUAL(list.size(), 1);
+  BOOST_CHECK_GT(list.getOccupancy(), 0.0);
+
+  list.remove(keyB);
+  BOOST_CHECK_EQUAL(list.size(), 1);
+  list.remove(keyA);
+  BOOST_CHECK_EQUAL(list.has(keyA), false);
+  BOOST_CHECK_EQUAL(list.size(), 0);
+  BOOST_CHECK_EQUAL(list.getOccupancy(), 0.0);
+
+  BOOST_CHECK_EQUAL(list.getNLookups(), 4);
+  BOOST_CHECK_EQUAL(list.getNHits(), 1);
+  BOOST_CHECK_THROW(::nfd::DeadDenmList(time::seconds(1), 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Rotation)
+{
+  ::nfd::DeadDenmList list(time::milliseconds(100));
+  auto keyA = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/A");
+  auto keyB = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/B");
+  list.add(keyA);
+
+  // keyA is remembered through the next window
+  Simulator::Schedule(MilliSeconds(150), MakeEvent([&] {
+    BOOST_CHECK_EQUAL(list.has(keyA), true);
+    list.add(keyB);
+    BOOST_CHECK_EQUAL(list.size(), 2);
+  }));
+  // and forgotten after that
+  Simulator::Schedule(MilliSeconds(250), MakeEvent([&] {
+    BOOST_CHECK_EQUAL(list.has(keyA), false);
+    BOOST_CHECK_EQUAL(list.has(keyB), true);
+    BOOST_CHECK_EQUAL(list.size(), 1);
+  }));
+  // after two idle windows, nothing is remembered
+  Simulator::Schedule(MilliSeconds(500), MakeEvent([&] {
+    BOOST_CHECK_EQUAL(list.has(keyB), false);
+    BOOST_CHECK_EQUAL(list.size(), 0);
+  }));
+
+  Simulator::Stop(MilliSeconds(600));
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositives)
+{
+  ::nfd::DeadDenmList list(time::seconds(10), 256);
+  BOOST_CHECK_EQUAL(list.getFalsePositiveProbability(), 0.0);
+
+  for (int i = 0; i < 64; ++i) {
+    list.add(::nfd::PendingRebroadcastTable::computeKey(Name("/denm/0/1").appendNumber(i)));
+  }
+  double estimate = list.getFalsePositiveProbability();
+  BOOST_CHECK_GT(estimate, 0.0);
+  BOOST_CHECK_LT(estimate, 1.0);
+
+  int nFalsePositives = 0;
+  for (int i = 0; i < 1000; ++i) {
+    if (list.has(::nfd::PendingRebroadcastTable::computeKey(Name("/denm/0/2").appendNumber(i)))) {
+      ++nFalsePositives;
+    }
+  }
+  BOOST_CHECK_LT(nFalsePositives / 1000.0, estimate * 3 + 0.01);
+  BOOST_CHECK_EQUAL(list.getNHits(), nFalsePositives);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,188 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-dcc.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::fw::DenmDcc;
+using ::nfd::fw::DccState;
+
+BOOST_AUTO_TEST_SUITE(TestDenmDcc)
+
+static DenmDcc::Options
+makeOptions()
+{
+  DenmDcc::Options options;
+  // one sampling interval of 100ms carries 12500 bytes
+  options.dataRate = 1000000;
+  options.frameOverhead = time::nanoseconds::zero();
+  return options;
+}
+
+BOOST_AUTO_TEST_CASE(StateTransitions)
+{
+  DenmDcc dcc(makeOptions(), CreateObject<UniformRandomVariable>());
+  time::steady_clock::TimePoint now(time::seconds(1));
+  DenmDcc::Load load;
+
+  // the first sample only sets the baseline
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, 0), false);
+  BOOST_CHECK_EQUAL(dcc.getState(), DccState::RELAXED);
+
+  // too early for another estimation
+  load.nBytes = 12500;
+  BOOST_CHECK_EQUAL(dcc.sample(now + time::milliseconds(50), load, 0), false);
+  BOOST_CHECK_EQUAL(dcc.getCbr(), 0.0);
+
+  // the channel is 90% busy: the smoothed CBR climbs over three intervals
+  load.nBytes = 11250;
+  now += time::milliseconds(100);
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, 0), false);
+  BOOST_CHECK_CLOSE(dcc.getCbr(), 0.225, 0.001);
+
+  load.nBytes += 11250;
+  now += time::milliseconds(100);
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, 0), true);
+  BOOST_CHECK_EQUAL(dcc.getState(), DccState::ACTIVE);
+
+  load.nBytes += 11250;
+  now += time::milliseconds(100);
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, 0), true);
+  BOOST_CHECK_EQUAL(dcc.getState(), DccState::RESTRICTIVE);
+
+  // the channel falls idle
+  now += time::milliseconds(100);
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, 0), true);
+  BOOST_CHECK_EQUAL(dcc.getState(), DccState::ACTIVE);
+
+  now += time::milliseconds(100);
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, 0), true);
+  BOOST_CHECK_EQUAL(dcc.getState(), DccState::RELAXED);
+}
+
+BOOST_AUTO_TEST_CASE(QueueBacklog)
+{
+  DenmDcc::Options options = makeOptions();
+  DenmDcc dcc(options, CreateObject<UniformRandomVariable>());
+  time::steady_clock::TimePoint now(time::seconds(1));
+  DenmDcc::Load load;
+
+  dcc.sample(now, load, 0);
+  now += time::milliseconds(100);
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, options.queueThreshold + 1), true);
+  BOOST_CHECK_EQUAL(dcc.getState(), DccState::ACTIVE);
+  BOOST_CHECK_EQUAL(dcc.getCbr(), 0.0);
+
+  now += time::milliseconds(100);
+  // the queue length of the transport is unknown
+  BOOST_CHECK_EQUAL(dcc.sample(now, load, -1), true);
+  BOOST_CHECK_EQUAL(dcc.getState(), DccState::RELAXED);
+}
+
+BOOST_AUTO_TEST_CASE(GapPerPriority)
+{
+  DenmDcc dcc(makeOptions(), CreateObject<UniformRandomVariable>());
+  time::steady_clock::TimePoint now(time::seconds(1));
+
+  // relaxed: back-to-back rebroadcasts
+  dcc.afterTransmit(3, now);
+  BOOST_CHECK_EQUAL(dcc.getWait(3, now), time::nanoseconds::zero());
+
+  DenmDcc::Load load;
+  dcc.sample(now, load, 0);
+  now += time::milliseconds(100);
+  dcc.sample(now, load, 1 << 20);
+  BOOST_REQUIRE_EQUAL(dcc.getState(), DccState::ACTIVE);
+
+  // a rebroadcast holds back its own and less urgent priorities only
+  dcc.afterTransmit(2, now);
+  BOOST_CHECK_EQUAL(dcc.getWait(0, now), time::nanoseconds::zero());
+  BOOST_CHECK_EQUAL(dcc.getWait(1, now), time::nanoseconds::zero());
+  BOOST_CHECK_EQUAL(dcc.getWait(2, now), DenmDcc::getGap(DccState::ACTIVE, 2));
+  BOOST_CHECK_EQUAL(dcc.getWait(3, now), DenmDcc::getGap(DccState::ACTIVE, 3));
+
+  dcc.afterTransmit(0, now);
+  BOOST_CHECK_EQUAL(dcc.getWait(0, now), DenmDcc::getGap(DccState::ACTIVE, 0));
+  BOOST_CHECK_EQUAL(dcc.getWait(0, now + time::milliseconds(200)), time::nanoseconds::zero());
+
+  // application types beyond the table share the least urgent priority
+  BOOST_CHECK_EQUAL(dcc.getWait(7, now), dcc.getWait(3, now));
+}
+
+BOOST_AUTO_TEST_CASE(DropProbability)
+{
+  for (auto state : {DccState::RELAXED, DccState::ACTIVE, DccState::RESTRICTIVE}) {
+    BOOST_CHECK_EQUAL(DenmDcc::getDropProbability(state, 0), 0.0);
+    for (size_t priority = 1; priority < DenmDcc::N_PRIORITIES; ++priority) {
+      BOOST_CHECK_LE(DenmDcc::getDropProbability(state, priority - 1),
+                     DenmDcc::getDropProbability(state, priority));
+      BOOST_CHECK_LE(DenmDcc::getGap(state, priority - 1), DenmDcc::getGap(state, priority));
+    }
+  }
+  BOOST_CHECK_GT(DenmDcc::getDropProbability(DccState::RESTRICTIVE, 3), 0.0);
+
+  // the most urgent DENMs are never dropped, even when the channel is saturated
+  DenmDcc dcc(makeOptions(), CreateObject<UniformRandomVariable>());
+  time::steady_clock::TimePoint now(time::seconds(1));
+  DenmDcc::Load load;
+  dcc.sample(now, load, 0);
+  for (int i = 0; i < 3; ++i) {
+    load.nBytes += 12500;
+    now += time::milliseconds(100);
+    dcc.sample(now, load, 0);
+  }
+  BOOST_REQUIRE_EQUAL(dcc.getState(), DccState::RESTRICTIVE);
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK_EQUAL(dcc.shouldDrop(0), false);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ReproducibleDrops)
+{
+  auto makeRestrictive = [] {
+    auto rng = CreateObject<UniformRandomVariable>();
+    rng->SetStream(3);
+    auto dcc = make_unique<DenmDcc>(makeOptions(), rng);
+    time::steady_clock::TimePoint now(time::seconds(1));
+    DenmDcc::Load load;
+    dcc->sample(now, load, 0);
+    for (int i = 0; i < 3; ++i) {
+      load.nBytes += 12500;
+      now += time::milliseconds(100);
+      dcc->sample(now, load, 0);
+    }
+    return dcc;
+  };
+
+  auto dccA = makeRestrictive();
+  auto dccB = makeRestrictive();
+  BOOST_REQUIRE_EQUAL(dccA->getState(), DccState::RESTRICTIVE);
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK_EQUAL(dccA->shouldDrop(3), dccB->shouldDrop(3));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
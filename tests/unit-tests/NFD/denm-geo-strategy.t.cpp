@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-geo-strategy.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include <ndn-cxx/lp/geo-tag.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::fw::DenmDecision;
+
+class DenmGeoStrategyFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  DenmGeoStrategyFixture()
+  {
+    // the link is slower than DenmScopeTable::DEFAULT_SCOPE's 20ms temporal range
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("30ms"));
+    Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("20p"));
+
+    createTopology({
+        {"1", "2"}
+      });
+
+    StrategyChoiceHelper::InstallAll("/denm", "/localhost/nfd/strategy/denm-geo");
+
+    addApps({
+        {"1", "ns3::ndn::Producer",
+            {{"Prefix", "/denm"}, {"PayloadSize", "100"}, {"AdvTransmissionInterval", "10000"}},
+            "1s", "2s"} // push just one DENM
+      });
+  }
+
+  void
+  OnDenmDecision(const Name&, DenmDecision decision, time::nanoseconds)
+  {
+    decisions.push_back(decision);
+  }
+
+  void
+  OnInData(const Data& data, const Face&)
+  {
+    inData.push_back(data.shared_from_this());
+    hasInGeoTag.push_back(data.getTag<lp::GeoTag>() != nullptr);
+  }
+
+  void
+  OnOutData(const Data& data, const Face& face)
+  {
+    if (face.getScope() == ::ndn::nfd::FACE_SCOPE_NON_LOCAL) {
+      hasOutTags.push_back(data.getTag<lp::GeoTag>() != nullptr ||
+                           data.getTag<lp::PriorityTag>() != nullptr);
+    }
+  }
+
+protected:
+  std::vector<DenmDecision> decisions;
+  std::vector<shared_ptr<const Data>> inData;
+  std::vector<bool> hasInGeoTag;
+  std::vector<bool> hasOutTags;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdFwDenmGeoStrategy, DenmGeoStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(DropBeforeDecode)
+{
+  Ptr<L3Protocol> l3 = L3Protocol::getL3Protocol(getNode("2"));
+  l3->TraceConnectWithoutContext("DenmDecisions",
+                                 MakeCallback(&DenmGeoStrategyFixture::OnDenmDecision, this));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // the DENM arrives out of its temporal scope and never enters the incoming Data pipeline
+  BOOST_REQUIRE_EQUAL(decisions.size(), 1);
+  BOOST_CHECK_EQUAL(decisions.front(), DenmDecision::OUT_OF_SCOPE);
+  BOOST_CHECK_EQUAL(l3->getForwarder()->getCounters().nInData, 0);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeNameOnce)
+{
+  // within DenmScopeTable::DEFAULT_SCOPE's temporal range
+  Config::Set("/ChannelList/*/$ns3::PointToPointChannel/Delay", StringValue("1ms"));
+
+  Ptr<L3Protocol> l3 = L3Protocol::getL3Protocol(getNode("2"));
+  l3->TraceConnectWithoutContext("DenmDecisions",
+                                 MakeCallback(&DenmGeoStrategyFixture::OnDenmDecision, this));
+  l3->TraceConnectWithoutContext("InData", MakeCallback(&DenmGeoStrategyFixture::OnInData, this));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  BOOST_REQUIRE(!decisions.empty());
+  BOOST_CHECK_EQUAL(decisions.front(), DenmDecision::SCHEDULED);
+
+  // the Data carries what wantUnsolicitedData decoded from its name
+  BOOST_REQUIRE_EQUAL(inData.size(), 1);
+  const Data& data = *inData.front();
+  auto denmTag = data.getTag<::nfd::fw::DenmNameTag>();
+  auto keyTag = data.getTag<::nfd::PendingRebroadcastKeyTag>();
+  BOOST_REQUIRE(denmTag != nullptr);
+  BOOST_REQUIRE(keyTag != nullptr);
+
+  ::nfd::fw::DenmName denm;
+  BOOST_REQUIRE(::nfd::fw::DenmName::decode(data.getName(), denm));
+  BOOST_CHECK_EQUAL(denmTag->get().sequence, denm.sequence);
+  BOOST_CHECK_EQUAL(denmTag->get().appType, denm.appType);
+  BOOST_CHECK_EQUAL(keyTag->get(), ::nfd::PendingRebroadcastTable::computeKey(data.getName()));
+}
+
+BOOST_AUTO_TEST_CASE(EgressFieldsNotAttached)
+{
+  Config::Set("/ChannelList/*/$ns3::PointToPointChannel/Delay", StringValue("1ms"));
+
+  L3Protocol::getL3Protocol(getNode("1"))->TraceConnectWithoutContext("OutData",
+    MakeCallback(&DenmGeoStrategyFixture::OnOutData, this));
+  L3Protocol::getL3Protocol(getNode("2"))->TraceConnectWithoutContext("InData",
+    MakeCallback(&DenmGeoStrategyFixture::OnInData, this));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // the rebroadcast carries the position of the sender, but the shared Data is never tagged with it
+  BOOST_REQUIRE_EQUAL(hasOutTags.size(), 1);
+  BOOST_CHECK_EQUAL(hasOutTags.front(), false);
+  BOOST_REQUIRE_EQUAL(hasInGeoTag.size(), 1);
+  BOOST_CHECK_EQUAL(hasInGeoTag.front(), true);
+}
+
+BOOST_AUTO_TEST_CASE(AssignStreams)
+{
+  NodeContainer nodes = NodeContainer::GetGlobal();
+
+  // one stream per node for the suppression delays, none for the default strategy
+  BOOST_CHECK_EQUAL(StrategyChoiceHelper::AssignStreams(nodes, "/denm", 10), 2);
+  BOOST_CHECK_EQUAL(StrategyChoiceHelper::AssignStreams(nodes, "/", 10), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/denm-scope-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::fw::DenmName;
+using ::nfd::fw::DenmNameTag;
+
+BOOST_AUTO_TEST_SUITE(TestDenmName)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  DenmName denm;
+  denm.appType = 2;
+  denm.contentType = 3;
+  denm.eventX = 1234.567;
+  denm.eventY = -89.012;
+  denm.eventTime = time::milliseconds(4500);
+  denm.referenceTime = time::milliseconds(4600);
+  denm.sequence = 42;
+
+  Name name = denm.toName();
+  BOOST_CHECK_EQUAL(name.size(), 7);
+  BOOST_CHECK_EQUAL(name[0], DenmName::getKeyword());
+
+  DenmName decoded;
+  BOOST_REQUIRE(DenmName::decode(name, decoded));
+  BOOST_CHECK_EQUAL(decoded.appType, 2);
+  BOOST_CHECK_EQUAL(decoded.contentType, 3);
+  BOOST_CHECK_CLOSE(decoded.eventX, 1234.567, 0.0001);
+  BOOST_CHECK_CLOSE(decoded.eventY, -89.012, 0.0001);
+  BOOST_CHECK_EQUAL(decoded.eventTime.count(), 4500);
+  BOOST_CHECK_EQUAL(decoded.referenceTime.count(), 4600);
+  BOOST_CHECK_EQUAL(decoded.sequence, 42);
+
+  BOOST_CHECK_EQUAL(decoded.isTermination, false);
+
+  denm.isTermination = true;
+  name = denm.toName();
+  BOOST_CHECK_EQUAL(name.size(), 8);
+  BOOST_REQUIRE(DenmName::decode(name, decoded));
+  BOOST_CHECK_EQUAL(decoded.isTermination, true);
+  BOOST_CHECK_EQUAL(decoded.sequence, 42);
+
+  BOOST_CHECK(!DenmName::decode("/prefix/1/2/3/4/5", decoded));
+  BOOST_CHECK(!DenmName::decode("/denm/1/2/3/4/5", decoded));
+  BOOST_CHECK(!DenmName::decode(name.getPrefix(6), decoded));
+
+  // a DENM is not generated before its event is detected
+  denm.referenceTime = time::milliseconds(4400);
+  BOOST_CHECK(!DenmName::decode(denm.toName(), decoded));
+}
+
+BOOST_AUTO_TEST_CASE(TypeOutOfRange)
+{
+  DenmName denm;
+  denm.appType = 1;
+  denm.contentType = 1;
+  Name name = denm.toName();
+  DenmName decoded;
+  BOOST_REQUIRE(DenmName::decode(name, decoded));
+
+  // 2^32 + 1 would be narrowed to 1
+  Name wideAppType = Name().append(name[0]).appendNumber(4294967297).append(name.getSubName(2));
+  BOOST_CHECK(!DenmName::decode(wideAppType, decoded));
+  Name wideContentType = name.getPrefix(2).appendNumber(4294967297).append(name.getSubName(3));
+  BOOST_CHECK(!DenmName::decode(wideContentType, decoded));
+
+  Name lastAppType = Name().append(name[0])
+                       .appendNumber(::nfd::DenmScopeTable::N_APP_TYPES - 1)
+                       .append(name.getSubName(2));
+  BOOST_CHECK(DenmName::decode(lastAppType, decoded));
+  Name pastAppType = Name().append(name[0])
+                       .appendNumber(::nfd::DenmScopeTable::N_APP_TYPES)
+                       .append(name.getSubName(2));
+  BOOST_CHECK(!DenmName::decode(pastAppType, decoded));
+  Name pastContentType = name.getPrefix(2)
+                           .appendNumber(::nfd::DenmScopeTable::N_CONTENT_TYPES)
+                           .append(name.getSubName(3));
+  BOOST_CHECK(!DenmName::decode(pastContentType, decoded));
+
+  // the output is left unchanged on failure
+  BOOST_CHECK_EQUAL(decoded.appType, ::nfd::DenmScopeTable::N_APP_TYPES - 1);
+}
+
+BOOST_AUTO_TEST_CASE(CachedTag)
+{
+  DenmName denm;
+  denm.appType = 1;
+  denm.sequence = 7;
+
+  Data data(denm.toName().append("payload"));
+  BOOST_CHECK(data.getTag<DenmNameTag>() == nullptr);
+
+  auto tag = ::nfd::fw::getDenmName(data);
+  BOOST_REQUIRE(tag != nullptr);
+  BOOST_CHECK_EQUAL(tag->get().appType, 1);
+  BOOST_CHECK_EQUAL(tag->get().sequence, 7);
+  BOOST_CHECK_EQUAL(data.getTag<DenmNameTag>(), tag);
+  BOOST_CHECK_EQUAL(::nfd::fw::getDenmName(data), tag);
+
+  Data other("/other/name");
+  BOOST_CHECK(::nfd::fw::getDenmName(other) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,202 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/denm-scope-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/mgmt/tables-config-section.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::DenmScopeTable;
+
+BOOST_FIXTURE_TEST_SUITE(TestDenmScopeTable, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Lookup)
+{
+  DenmScopeTable table;
+  const DenmScopeTable::Scope* scope = table.find(0, 0);
+  BOOST_REQUIRE(scope != nullptr);
+  BOOST_CHECK_EQUAL(scope->spatialRange, DenmScopeTable::DEFAULT_SCOPE.spatialRange);
+  BOOST_CHECK_EQUAL(scope->temporalRange, DenmScopeTable::DEFAULT_SCOPE.temporalRange);
+
+  table.set(1, 2, {500.0, time::seconds(3)});
+  BOOST_CHECK_EQUAL(table.find(1, 2)->spatialRange, 500.0);
+  BOOST_CHECK_EQUAL(table.find(1, 2)->temporalRange, time::seconds(3));
+  BOOST_CHECK_EQUAL(table.find(2, 1)->spatialRange, DenmScopeTable::DEFAULT_SCOPE.spatialRange);
+
+  table.setDefault({100.0, time::seconds(1)});
+  BOOST_CHECK_EQUAL(table.find(1, 2)->spatialRange, 100.0);
+  BOOST_CHECK_EQUAL(table.find(3, 3)->temporalRange, time::seconds(1));
+}
+
+BOOST_AUTO_TEST_CASE(OutOfRange)
+{
+  DenmScopeTable table;
+  BOOST_CHECK(table.find(DenmScopeTable::N_APP_TYPES, 0) == nullptr);
+  BOOST_CHECK(table.find(0, DenmScopeTable::N_CONTENT_TYPES) == nullptr);
+  BOOST_CHECK(table.find(DenmScopeTable::N_APP_TYPES, 0, 0.0, 0.0) == nullptr);
+  BOOST_CHECK_THROW(table.set(DenmScopeTable::N_APP_TYPES, 0, {1.0, time::seconds(1)}), std::out_of_range);
+  BOOST_CHECK_THROW(DenmScopeTable::getIndex(0, DenmScopeTable::N_CONTENT_TYPES), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(RegionOverride)
+{
+  DenmScopeTable table;
+  table.set(0, 1, {300.0, time::seconds(2)});
+  auto& region = table.addRegion(0.0, 0.0, 100.0, 100.0);
+  // a region starts from the base scopes
+  BOOST_CHECK_EQUAL(region.scopes[DenmScopeTable::getIndex(0, 1)].spatialRange, 300.0);
+  region.scopes[DenmScopeTable::getIndex(0, 1)] = {50.0, time::seconds(1)};
+  table.addRegion(50.0, 50.0, 200.0, 200.0).scopes[DenmScopeTable::getIndex(0, 1)] = {80.0, time::seconds(1)};
+
+  BOOST_CHECK_EQUAL(table.find(0, 1, 10.0, 10.0)->spatialRange, 50.0);
+  BOOST_CHECK_EQUAL(table.find(0, 1, 100.0, 100.0)->spatialRange, 50.0); // bounds are inclusive
+  BOOST_CHECK_EQUAL(table.find(0, 1, 150.0, 150.0)->spatialRange, 80.0);
+  BOOST_CHECK_EQUAL(table.find(0, 1, 60.0, 60.0)->spatialRange, 50.0); // first region wins
+  BOOST_CHECK_EQUAL(table.find(0, 1, -10.0, 10.0)->spatialRange, 300.0);
+  BOOST_CHECK_EQUAL(table.find(0, 2, 10.0, 10.0)->spatialRange,
+                    DenmScopeTable::DEFAULT_SCOPE.spatialRange);
+}
+
+BOOST_AUTO_TEST_CASE(MaxTemporalRange)
+{
+  DenmScopeTable table;
+  table.setDefault({100.0, time::seconds(1)});
+  BOOST_CHECK_EQUAL(table.getMaxTemporalRange(), time::seconds(1));
+  table.set(3, 3, {100.0, time::seconds(4)});
+  BOOST_CHECK_EQUAL(table.getMaxTemporalRange(), time::seconds(4));
+  table.addRegion(0.0, 0.0, 1.0, 1.0).scopes[0] = {100.0, time::seconds(9)};
+  BOOST_CHECK_EQUAL(table.getMaxTemporalRange(), time::seconds(9));
+}
+
+class DenmScopeConfigFixture : public CleanupFixture
+{
+protected:
+  DenmScopeConfigFixture()
+    : forwarder(faceTable)
+    , tablesConfig(forwarder)
+  {
+  }
+
+  void
+  runConfig(const std::string& config, bool isDryRun)
+  {
+    ::nfd::ConfigFile cf;
+    tablesConfig.setConfigFile(cf);
+    cf.parse(config, isDryRun, "dummy-config");
+  }
+
+protected:
+  ::nfd::FaceTable faceTable;
+  ::nfd::Forwarder forwarder;
+  ::nfd::TablesConfigSection tablesConfig;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Config, DenmScopeConfigFixture)
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      denm_scope
+      {
+        spatial_range 200
+        temporal_range 5000
+        scope
+        {
+          app_type 0
+          content_type 1
+          spatial_range 500
+        }
+        region
+        {
+          min_x 0
+          min_y 0
+          max_x 1000
+          max_y 50
+          spatial_range 100
+          scope
+          {
+            app_type 0
+            content_type 1
+            temporal_range 1000
+          }
+        }
+      }
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK(forwarder.getDenmScopeTable().getRegions().empty());
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  const DenmScopeTable& table = forwarder.getDenmScopeTable();
+  BOOST_CHECK_EQUAL(table.find(2, 2)->spatialRange, 200.0);
+  BOOST_CHECK_EQUAL(table.find(2, 2)->temporalRange, time::seconds(5));
+  BOOST_CHECK_EQUAL(table.find(0, 1)->spatialRange, 500.0);
+  BOOST_CHECK_EQUAL(table.find(0, 1)->temporalRange, time::seconds(5));
+
+  // the region's own ranges apply to every type, and its scopes override them
+  BOOST_REQUIRE_EQUAL(table.getRegions().size(), 1);
+  BOOST_CHECK_EQUAL(table.find(2, 2, 10.0, 10.0)->spatialRange, 100.0);
+  BOOST_CHECK_EQUAL(table.find(2, 2, 10.0, 10.0)->temporalRange, time::seconds(5));
+  BOOST_CHECK_EQUAL(table.find(0, 1, 10.0, 10.0)->spatialRange, 100.0);
+  BOOST_CHECK_EQUAL(table.find(0, 1, 10.0, 10.0)->temporalRange, time::seconds(1));
+  BOOST_CHECK_EQUAL(table.getMaxTemporalRange(), time::seconds(5));
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  auto makeConfig = [] (const std::string& body) {
+    return "tables\n{\n  denm_scope\n  {\n" + body + "\n  }\n}\n";
+  };
+
+  // unknown options
+  BOOST_CHECK_THROW(runConfig(makeConfig("range 100"), true), ::nfd::ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(makeConfig("scope { app_type 0 content_type 0 range 1 }"), true),
+                    ::nfd::ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(makeConfig("region { min_x 0 min_y 0 max_x 1 max_y 1 range 1 }"),
+                              true), ::nfd::ConfigFile::Error);
+
+  // missing or malformed values
+  BOOST_CHECK_THROW(runConfig(makeConfig("scope { app_type 0 spatial_range 1 }"), true),
+                    ::nfd::ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(makeConfig("region { min_x 0 min_y 0 max_x 1 }"), true),
+                    ::nfd::ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(makeConfig("spatial_range far"), true), ::nfd::ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(makeConfig("region { min_x 1 min_y 0 max_x 0 max_y 1 }"), true),
+                    ::nfd::ConfigFile::Error);
+
+  // DENM type out of range
+  BOOST_CHECK_THROW(runConfig(makeConfig("scope { app_type 4 content_type 0 }"), true),
+                    ::nfd::ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(makeConfig(
+                      "region { min_x 0 min_y 0 max_x 1 max_y 1 scope { app_type 0 content_type 9 } }"),
+                    true), ::nfd::ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Config
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-suppression.hpp"
+
+#include "../tests-common.hpp"
+
+#include <set>
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::fw::DenmReception;
+using ::nfd::fw::DenmSuppression;
+using ::nfd::fw::DenmSuppressionInfo;
+using ::nfd::fw::DenmAreaSuppression;
+
+BOOST_AUTO_TEST_SUITE(TestDenmSuppression)
+
+static DenmReception
+makeReception(double senderX, double selfX)
+{
+  DenmReception rx;
+  rx.event = Vector(0.0, 0.0, 0.0);
+  rx.sender = Vector(senderX, 0.0, 0.0);
+  rx.self = Vector(selfX, 0.0, 0.0);
+  return rx;
+}
+
+BOOST_AUTO_TEST_CASE(Contention)
+{
+  DenmSuppression::Options options;
+  options.maxDelay = time::milliseconds(10);
+  auto scheme = DenmSuppression::create("contention", options,
+                                       CreateObject<UniformRandomVariable>());
+
+  DenmSuppressionInfo info;
+  auto rxNear = makeReception(0.0, 20.0);
+  info.addReception(rxNear);
+  auto nearDelay = scheme->afterFirstReception(rxNear, info);
+  BOOST_REQUIRE(nearDelay);
+  BOOST_CHECK_GE(*nearDelay, time::milliseconds(9));
+  BOOST_CHECK_LE(*nearDelay, time::milliseconds(19));
+
+  // a receiver at the edge of the radio range contends with the random part only
+  auto rxFar = makeReception(0.0, options.radioRange);
+  auto farDelay = scheme->afterFirstReception(rxFar, info);
+  BOOST_REQUIRE(farDelay);
+  BOOST_CHECK_LE(*farDelay, options.maxDelay);
+
+  BOOST_CHECK_EQUAL(scheme->shouldCancel(rxFar, info), true);
+}
+
+BOOST_AUTO_TEST_CASE(Counter)
+{
+  DenmSuppression::Options options;
+  options.counterThreshold = 3;
+  auto scheme = DenmSuppression::create("counter", options,
+                                       CreateObject<UniformRandomVariable>());
+
+  DenmSuppressionInfo info;
+  auto rx = makeReception(0.0, 100.0);
+  info.addReception(rx);
+  BOOST_CHECK(scheme->afterFirstReception(rx, info));
+  info.addReception(rx);
+  BOOST_CHECK_EQUAL(scheme->shouldCancel(rx, info), false);
+  info.addReception(rx);
+  BOOST_CHECK_EQUAL(scheme->shouldCancel(rx, info), true);
+}
+
+BOOST_AUTO_TEST_CASE(Distance)
+{
+  DenmSuppression::Options options;
+  options.distanceThreshold = 50.0;
+  auto scheme = DenmSuppression::create("distance", options,
+                                       CreateObject<UniformRandomVariable>());
+
+  DenmSuppressionInfo info;
+  auto rxClose = makeReception(80.0, 100.0);
+  info.addReception(rxClose);
+  BOOST_CHECK(!scheme->afterFirstReception(rxClose, info));
+
+  auto rxFar = makeReception(0.0, 100.0);
+  BOOST_CHECK(scheme->afterFirstReception(rxFar, info));
+  BOOST_CHECK_EQUAL(scheme->shouldCancel(rxFar, info), false);
+  BOOST_CHECK_EQUAL(scheme->shouldCancel(rxClose, info), true);
+}
+
+BOOST_AUTO_TEST_CASE(Area)
+{
+  DenmSuppression::Options options;
+  options.radioRange = 200.0;
+  DenmAreaSuppression scheme(options, CreateObject<UniformRandomVariable>());
+
+  Vector self(0.0, 0.0, 0.0);
+  BOOST_CHECK_CLOSE(scheme.computeAdditionalCoverage(self, {}), 1.0, 0.001);
+  BOOST_CHECK_SMALL(scheme.computeAdditionalCoverage(self, {self}), 0.001);
+
+  // a sender at the edge of the range leaves about 61% of the disc uncovered
+  double coverage = scheme.computeAdditionalCoverage(self, {Vector(200.0, 0.0, 0.0)});
+  BOOST_CHECK_GT(coverage, 0.55);
+  BOOST_CHECK_LT(coverage, 0.67);
+
+  // senders on both sides leave little to cover
+  DenmSuppressionInfo info;
+  info.senders = {Vector(-60.0, 0.0, 0.0), Vector(60.0, 0.0, 0.0)};
+  DenmReception rx;
+  rx.self = self;
+  BOOST_CHECK_EQUAL(scheme.shouldCancel(rx, info), true);
+}
+
+BOOST_AUTO_TEST_CASE(Reproducible)
+{
+  DenmSuppression::Options options;
+  options.maxDelay = time::milliseconds(10);
+  auto rngA = CreateObject<UniformRandomVariable>();
+  auto rngB = CreateObject<UniformRandomVariable>();
+  rngA->SetStream(7);
+  rngB->SetStream(7);
+  auto schemeA = DenmSuppression::create("counter", options, rngA);
+  auto schemeB = DenmSuppression::create("counter", options, rngB);
+
+  DenmSuppressionInfo info;
+  auto rx = makeReception(0.0, 100.0);
+  info.addReception(rx);
+  std::set<time::nanoseconds> delays;
+  for (int i = 0; i < 5; ++i) {
+    auto delayA = schemeA->afterFirstReception(rx, info);
+    auto delayB = schemeB->afterFirstReception(rx, info);
+    BOOST_REQUIRE(delayA && delayB);
+    BOOST_CHECK_EQUAL(*delayA, *delayB);
+    BOOST_CHECK_LE(*delayA, options.maxDelay);
+    delays.insert(*delayA);
+  }
+  BOOST_CHECK_GT(delays.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownScheme)
+{
+  BOOST_CHECK_THROW(DenmSuppression::create("flooding", DenmSuppression::Options(),
+                                            CreateObject<UniformRandomVariable>()),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
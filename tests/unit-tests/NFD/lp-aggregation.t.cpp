@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/face/generic-link-service.hpp"
+
+#include "helper/ndn-geo-broadcast-helper.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node-container.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::face::GenericLinkService;
+
+class LpAggregationFixture : public CleanupFixture
+{
+public:
+  LpAggregationFixture()
+  {
+    for (double x : {0.0, 100.0}) {
+      Ptr<Node> node = CreateObject<Node>();
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel>();
+      mobility->SetPosition(Vector(x, 0, 0));
+      node->AggregateObject(mobility);
+      nodes.Add(node);
+    }
+    devices = GeoBroadcastHelper().Install(nodes);
+
+    StackHelper stackHelper;
+    stackHelper.setLpAggregation(MilliSeconds(2));
+    stackHelper.Install(nodes);
+
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+      faces.push_back(L3Protocol::getL3Protocol(nodes.Get(i))->getFaceByNetDevice(devices.Get(i)));
+    }
+  }
+
+  void
+  sendData(uint32_t i, size_t payloadSize)
+  {
+    Data data("/prefix/" + std::to_string(m_seq++));
+    data.setContent(std::make_shared<::ndn::Buffer>(payloadSize));
+    StackHelper::getKeyChain().sign(data);
+    faces[i]->sendData(data, 0);
+  }
+
+  const GenericLinkService::Counters&
+  getCounters(uint32_t i)
+  {
+    auto linkService = dynamic_cast<GenericLinkService*>(faces[i]->getLinkService());
+    BOOST_REQUIRE(linkService != nullptr);
+    return linkService->getCounters();
+  }
+
+  uint64_t
+  getNInData(uint32_t i)
+  {
+    return L3Protocol::getL3Protocol(nodes.Get(i))->getForwarder()->getCounters().nInData;
+  }
+
+protected:
+  NodeContainer nodes;
+  NetDeviceContainer devices;
+  std::vector<shared_ptr<Face>> faces;
+
+private:
+  int m_seq = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NfdFaceLpAggregation, LpAggregationFixture)
+
+BOOST_AUTO_TEST_CASE(WithinHoldTime)
+{
+  Simulator::Schedule(Seconds(1), &LpAggregationFixture::sendData, this, 0, 100);
+  Simulator::Schedule(Seconds(1.001), &LpAggregationFixture::sendData, this, 0, 100);
+  Simulator::Schedule(Seconds(1.001), &LpAggregationFixture::sendData, this, 0, 100);
+  // after the hold time
+  Simulator::Schedule(Seconds(1.5), &LpAggregationFixture::sendData, this, 0, 100);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(getCounters(0).nOutAggregates, 1);
+  BOOST_CHECK_EQUAL(getCounters(0).nOutAggregatedPackets, 3);
+  BOOST_CHECK_EQUAL(faces[0]->getCounters().nOutPackets, 2);
+  BOOST_CHECK_EQUAL(getCounters(1).nInAggregates, 1);
+  BOOST_CHECK_EQUAL(getNInData(1), 4);
+}
+
+BOOST_AUTO_TEST_CASE(UpToMtu)
+{
+  // two of these packets fit in the 1500-octet MTU, three do not
+  Simulator::Schedule(Seconds(1), &LpAggregationFixture::sendData, this, 0, 450);
+  Simulator::Schedule(Seconds(1), &LpAggregationFixture::sendData, this, 0, 450);
+  Simulator::Schedule(Seconds(1), &LpAggregationFixture::sendData, this, 0, 450);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(getCounters(0).nOutAggregates, 1);
+  BOOST_CHECK_EQUAL(getCounters(0).nOutAggregatedPackets, 2);
+  BOOST_CHECK_EQUAL(faces[0]->getCounters().nOutPackets, 2);
+  BOOST_CHECK_EQUAL(getNInData(1), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/pending-rebroadcast-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestPendingRebroadcastTable, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(ScheduleFireCancel)
+{
+  ::nfd::TimerWheel wheel;
+  ::nfd::PendingRebroadcastTable table;
+  auto keyA = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/A");
+  auto keyB = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/B");
+  BOOST_CHECK_NE(keyA, keyB);
+
+  int nFired = 0;
+  auto expiry = time::steady_clock::now() + time::seconds(1);
+  auto fire = [&] (::nfd::PendingRebroadcastTable::Key key) {
+    ++nFired;
+    table.markFired(key);
+  };
+  table.insert(keyA, wheel.schedule(time::milliseconds(10), [=] { fire(keyA); }), expiry);
+  table.insert(keyB, wheel.schedule(time::milliseconds(10), [=] { fire(keyB); }), expiry);
+  BOOST_CHECK_EQUAL(table.size(), 2);
+  BOOST_CHECK_EQUAL(table.getNPending(), 2);
+
+  BOOST_CHECK_EQUAL(table.cancel(keyB), true);
+  BOOST_CHECK_EQUAL(table.cancel(keyB), false);
+  BOOST_CHECK_EQUAL(table.getNPending(), 1);
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+
+  Simulator::Stop(MilliSeconds(20));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nFired, 1);
+  BOOST_CHECK_EQUAL(table.getNPending(), 0);
+  BOOST_REQUIRE(table.find(keyA) != nullptr);
+  BOOST_CHECK_EQUAL(table.find(keyA)->isPending(), false);
+}
+
+BOOST_AUTO_TEST_CASE(AgeOut)
+{
+  ::nfd::TimerWheel wheel;
+  ::nfd::PendingRebroadcastTable table;
+  auto keyA = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/A");
+  auto keyB = ::nfd::PendingRebroadcastTable::computeKey("/denm/0/1/B");
+
+  bool hasFired = false;
+  table.insert(keyA, wheel.schedule(time::milliseconds(50), [&] { hasFired = true; }),
+               time::steady_clock::now() + time::milliseconds(20));
+
+  Simulator::Schedule(MilliSeconds(30), MakeEvent([&] {
+    BOOST_CHECK(table.find(keyA) == nullptr);
+    table.insert(keyB, time::steady_clock::now() + time::milliseconds(20));
+    BOOST_CHECK_EQUAL(table.size(), 1);
+  }));
+
+  Simulator::Stop(MilliSeconds(100));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(hasFired, false);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  table.evictExpired();
+  BOOST_CHECK_EQUAL(table.size(), 0);
+  BOOST_CHECK_EQUAL(table.getNPending(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/common/timer-wheel.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::TimerWheel;
+
+BOOST_FIXTURE_TEST_SUITE(TestTimerWheel, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(FireInOrder)
+{
+  TimerWheel wheel(time::milliseconds(1));
+  std::vector<std::pair<int, Time>> fired;
+  auto record = [&] (int id) { fired.emplace_back(id, Simulator::Now()); };
+
+  // spread over all levels: 1 tick, within level 0, level 1, level 2
+  wheel.schedule(time::microseconds(300), [&] { record(1); });
+  wheel.schedule(time::milliseconds(200), [&] { record(2); });
+  wheel.schedule(time::milliseconds(200), [&] { record(3); });
+  wheel.schedule(time::seconds(30), [&] { record(5); });
+  wheel.schedule(time::milliseconds(4000), [&] { record(4); });
+  BOOST_CHECK_EQUAL(wheel.size(), 5);
+
+  Simulator::Stop(Seconds(60));
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(fired.size(), 5);
+  std::vector<int> order;
+  for (const auto& f : fired) {
+    order.push_back(f.first);
+  }
+  std::vector<int> expectedOrder{1, 2, 3, 4, 5};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expectedOrder.begin(), expectedOrder.end());
+
+  // deadlines are rounded up to the tick
+  BOOST_CHECK_EQUAL(fired[0].second, MilliSeconds(1));
+  BOOST_CHECK_EQUAL(fired[1].second, MilliSeconds(200));
+  BOOST_CHECK_EQUAL(fired[3].second, MilliSeconds(4000));
+  BOOST_CHECK_EQUAL(fired[4].second, Seconds(30));
+
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  BOOST_CHECK_EQUAL(wheel.getCounters().nScheduled, 5);
+  BOOST_CHECK_EQUAL(wheel.getCounters().nFired, 5);
+  BOOST_CHECK_GT(wheel.getCounters().nCascaded, 0);
+  // timers due in the same tick share one event, and empty ticks are skipped
+  BOOST_CHECK_LT(wheel.getCounters().nTicks, 50);
+}
+
+BOOST_AUTO_TEST_CASE(Cancel)
+{
+  TimerWheel wheel;
+  int nFired = 0;
+
+  auto a = wheel.schedule(time::milliseconds(5), [&] { ++nFired; });
+  auto b = wheel.schedule(time::milliseconds(5), [&] { ++nFired; });
+  TimerWheel::EventId empty;
+  BOOST_CHECK(a);
+  BOOST_CHECK(!empty);
+  BOOST_CHECK_EQUAL(empty.cancel(), false);
+
+  BOOST_CHECK_EQUAL(a.cancel(), true);
+  BOOST_CHECK(!a);
+  BOOST_CHECK_EQUAL(a.cancel(), false);
+
+  // a released record is reused, but the stale handle must not cancel the new timer
+  auto c = wheel.schedule(time::milliseconds(5), [&] { ++nFired; });
+  BOOST_CHECK_EQUAL(a.cancel(), false);
+  BOOST_CHECK(c);
+
+  Simulator::Stop(MilliSeconds(10));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nFired, 2);
+  BOOST_CHECK(!b);
+  BOOST_CHECK_EQUAL(b.cancel(), false);
+  BOOST_CHECK_EQUAL(wheel.getCounters().nCancelled, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleFromCallback)
+{
+  TimerWheel wheel(time::milliseconds(1));
+  std::vector<Time> fired;
+
+  std::function<void()> reschedule = [&] {
+    fired.push_back(Simulator::Now());
+    if (fired.size() < 3) {
+      wheel.schedule(time::nanoseconds(0), reschedule);
+    }
+  };
+  wheel.schedule(time::milliseconds(2), reschedule);
+
+  Simulator::Stop(MilliSeconds(10));
+  Simulator::Run();
+
+  // a zero delay still fires in a later tick
+  BOOST_REQUIRE_EQUAL(fired.size(), 3);
+  BOOST_CHECK_EQUAL(fired[0], MilliSeconds(2));
+  BOOST_CHECK_EQUAL(fired[1], MilliSeconds(3));
+  BOOST_CHECK_EQUAL(fired[2], MilliSeconds(4));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,269 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-denm-producer.hpp"
+#include "helper/ndn-app-helper.hpp"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::fw::DenmName;
+
+const boost::filesystem::path TEST_EVENTS = boost::filesystem::path(TEST_CONFIG_PATH) / "events.csv";
+
+/**
+ * @brief Replays a fixed list of events, and counts how often it is asked for the next one
+ */
+class ScriptedProcess : public DenmEventProcess
+{
+public:
+  ScriptedProcess(std::vector<Event> events, size_t& nCalls)
+    : m_events(std::move(events))
+    , m_nCalls(nCalls)
+  {
+  }
+
+  bool
+  Next(Time now, Event& event) override
+  {
+    ++m_nCalls;
+    if (m_next == m_events.size()) {
+      return false;
+    }
+    event = m_events[m_next++];
+    return true;
+  }
+
+private:
+  std::vector<Event> m_events;
+  size_t m_next = 0;
+  size_t& m_nCalls;
+};
+
+static DenmEventProcess::Event
+makeEvent(double time, double x, double y, uint32_t appType, uint32_t contentType, double duration)
+{
+  DenmEventProcess::Event event;
+  event.time = Seconds(time);
+  event.hasLocation = true;
+  event.location = Vector(x, y, 0.0);
+  event.appType = appType;
+  event.contentType = contentType;
+  event.duration = Seconds(duration);
+  return event;
+}
+
+class DenmProducerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  struct Sent
+  {
+    Time time;
+    Name name;
+    DenmName denm;
+  };
+
+  DenmProducerFixture()
+  {
+    createTopology({
+        {"1", "2"}
+      });
+  }
+
+  ~DenmProducerFixture()
+  {
+    boost::filesystem::remove(TEST_EVENTS);
+  }
+
+  Ptr<DenmProducer>
+  installProducer(AppHelper& helper, Time start, Time stop)
+  {
+    ApplicationContainer apps = helper.Install(getNode("1"));
+    apps.Start(start);
+    apps.Stop(stop);
+    apps.Get(0)->TraceConnectWithoutContext("TransmittedDatas",
+                                            MakeCallback(&DenmProducerFixture::OnData, this));
+    return DynamicCast<DenmProducer>(apps.Get(0));
+  }
+
+  void
+  OnData(shared_ptr<const Data> data, Ptr<App>, shared_ptr<Face>)
+  {
+    Sent s{Simulator::Now(), data->getName(), DenmName()};
+    BOOST_CHECK(DenmName::decode(data->getName(), s.denm));
+    sent.push_back(s);
+  }
+
+  size_t
+  countTerminations() const
+  {
+    return std::count_if(sent.begin(), sent.end(),
+                         [] (const Sent& s) { return s.denm.isTermination; });
+  }
+
+protected:
+  std::vector<Sent> sent;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnDenmProducer, DenmProducerFixture)
+
+BOOST_AUTO_TEST_CASE(CustomProcess)
+{
+  AppHelper helper("ns3::ndn::DenmProducer");
+  helper.SetAttribute("RepetitionInterval", StringValue("100ms"));
+  Ptr<DenmProducer> producer = installProducer(helper, Seconds(0.5), Seconds(10));
+
+  size_t nCalls = 0;
+  producer->SetEventProcess(make_unique<ScriptedProcess>(std::vector<DenmEventProcess::Event>{
+    makeEvent(1.0, 100.0, 200.0, 2, 3, 0.35)}, nCalls));
+  StringValue process;
+  producer->GetAttribute("Process", process);
+  BOOST_CHECK_EQUAL(process.Get(), "custom");
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // announced at 1.0s, repeated at 1.1s, 1.2s and 1.3s, terminated at 1.4s
+  BOOST_CHECK_EQUAL(nCalls, 2);
+  BOOST_REQUIRE_EQUAL(sent.size(), 5);
+  for (size_t i = 0; i < sent.size(); ++i) {
+    BOOST_CHECK_EQUAL(sent[i].time, Seconds(1.0 + 0.1 * i));
+    BOOST_CHECK_EQUAL(sent[i].denm.sequence, i + 1);
+    BOOST_CHECK_EQUAL(sent[i].denm.isTermination, i + 1 == sent.size());
+    BOOST_CHECK_EQUAL(sent[i].denm.appType, 2);
+    BOOST_CHECK_EQUAL(sent[i].denm.contentType, 3);
+    BOOST_CHECK_CLOSE(sent[i].denm.eventX, 100.0, 0.001);
+    BOOST_CHECK_CLOSE(sent[i].denm.eventY, 200.0, 0.001);
+    BOOST_CHECK_EQUAL(sent[i].denm.eventTime.count(), sent.front().denm.eventTime.count());
+    BOOST_CHECK_EQUAL(sent[i].denm.referenceTime.count(),
+                      sent.front().denm.eventTime.count() + 100 * static_cast<int>(i));
+    BOOST_CHECK_EQUAL(sent[i].name, sent[i].denm.toName());
+    BOOST_CHECK(DenmName::getKeyword() == sent[i].name.get(0));
+  }
+  BOOST_CHECK(sent.back().name.get(-1) == DenmName::getTerminationKeyword());
+  BOOST_CHECK_EQUAL(producer->GetNDroppedEvents(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TraceReplay)
+{
+  boost::filesystem::create_directories(TEST_CONFIG_PATH);
+  {
+    std::ofstream file(TEST_EVENTS.string().c_str());
+    file << "time,x,y,appType,contentType,duration\n"
+         << "# events need not be sorted\n"
+         << "1.5, 10, 20, 1, 2\n"
+         << "\n"
+         << "  # indented comment\n"
+         << "1.0,30,40,0,1,0.15\n";
+  }
+
+  AppHelper helper("ns3::ndn::DenmProducer");
+  helper.SetAttribute("Process", StringValue("trace"));
+  helper.SetAttribute("TraceFile", StringValue(TEST_EVENTS.string()));
+  helper.SetAttribute("RepetitionInterval", StringValue("100ms"));
+  helper.SetAttribute("EventDuration", StringValue("250ms"));
+  installProducer(helper, Seconds(0.5), Seconds(10));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // the second event lasts 0.15s as given; the first one lasts EventDuration
+  BOOST_REQUIRE_EQUAL(sent.size(), 7);
+  BOOST_CHECK_EQUAL(countTerminations(), 2);
+
+  BOOST_CHECK_EQUAL(sent[0].time, Seconds(1.0));
+  BOOST_CHECK_CLOSE(sent[0].denm.eventX, 30.0, 0.001);
+  BOOST_CHECK_CLOSE(sent[0].denm.eventY, 40.0, 0.001);
+  BOOST_CHECK_EQUAL(sent[0].denm.appType, 0);
+  BOOST_CHECK_EQUAL(sent[0].denm.contentType, 1);
+  BOOST_CHECK_EQUAL(sent[2].time, Seconds(1.2));
+  BOOST_CHECK_EQUAL(sent[2].denm.sequence, 3);
+  BOOST_CHECK(sent[2].denm.isTermination);
+
+  BOOST_CHECK_EQUAL(sent[3].time, Seconds(1.5));
+  BOOST_CHECK_CLOSE(sent[3].denm.eventX, 10.0, 0.001);
+  BOOST_CHECK_CLOSE(sent[3].denm.eventY, 20.0, 0.001);
+  BOOST_CHECK_EQUAL(sent[3].denm.appType, 1);
+  BOOST_CHECK_EQUAL(sent[3].denm.contentType, 2);
+  BOOST_CHECK_EQUAL(sent[6].time, Seconds(1.8));
+  BOOST_CHECK_EQUAL(sent[6].denm.sequence, 4);
+  BOOST_CHECK(sent[6].denm.isTermination);
+}
+
+BOOST_AUTO_TEST_CASE(MaxEvents)
+{
+  AppHelper helper("ns3::ndn::DenmProducer");
+  helper.SetAttribute("RepetitionInterval", StringValue("100ms"));
+  helper.SetAttribute("MaxEvents", UintegerValue(2));
+  Ptr<DenmProducer> producer = installProducer(helper, Seconds(0.5), Seconds(10));
+
+  size_t nCalls = 0;
+  producer->SetEventProcess(make_unique<ScriptedProcess>(std::vector<DenmEventProcess::Event>{
+    makeEvent(1.00, 0.0, 0.0, 0, 0, 1.0),
+    makeEvent(1.01, 1.0, 0.0, 0, 0, 1.0),
+    makeEvent(1.02, 2.0, 0.0, 0, 0, 1.0), // dropped
+    makeEvent(1.03, 3.0, 0.0, 0, 0, 1.0), // dropped
+    makeEvent(3.00, 4.0, 0.0, 0, 0, 0.05)}, nCalls)); // announced in a released slot
+
+  Simulator::Stop(Seconds(4));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(producer->GetNDroppedEvents(), 2);
+  std::vector<double> announced;
+  for (const Sent& s : sent) {
+    if (s.denm.sequence == 1) {
+      announced.push_back(s.denm.eventX);
+    }
+  }
+  std::vector<double> expected{0.0, 1.0, 4.0};
+  BOOST_CHECK_EQUAL_COLLECTIONS(announced.begin(), announced.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(countTerminations(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(StopApplication)
+{
+  AppHelper helper("ns3::ndn::DenmProducer");
+  helper.SetAttribute("RepetitionInterval", StringValue("100ms"));
+  Ptr<DenmProducer> producer = installProducer(helper, Seconds(0.5), Seconds(1.25));
+
+  size_t nCalls = 0;
+  producer->SetEventProcess(make_unique<ScriptedProcess>(std::vector<DenmEventProcess::Event>{
+    makeEvent(1.0, 0.0, 0.0, 0, 0, 10.0),
+    makeEvent(2.0, 0.0, 0.0, 0, 0, 10.0)}, nCalls));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // repetitions stop with the application, without a termination, and the next event is
+  // neither announced nor asked for
+  BOOST_REQUIRE_EQUAL(sent.size(), 3);
+  BOOST_CHECK_EQUAL(sent.back().time, Seconds(1.2));
+  BOOST_CHECK_EQUAL(countTerminations(), 0);
+  BOOST_CHECK_EQUAL(nCalls, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-denm-receiver.hpp"
+#include "helper/ndn-app-helper.hpp"
+#include "helper/ndn-strategy-choice-helper.hpp"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::nfd::fw::DenmName;
+
+const boost::filesystem::path TEST_EVENTS = boost::filesystem::path(TEST_CONFIG_PATH) / "events.csv";
+const boost::filesystem::path TEST_REPORT = boost::filesystem::path(TEST_CONFIG_PATH) / "report.csv";
+
+class DenmReceiverFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  DenmReceiverFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    // DENMs are only accepted within DenmScopeTable::DEFAULT_SCOPE's 20ms temporal range
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+    Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("20p"));
+
+    createTopology({
+        {"1", "2"}
+      });
+  }
+
+  ~DenmReceiverFixture()
+  {
+    boost::filesystem::remove(TEST_EVENTS);
+    boost::filesystem::remove(TEST_REPORT);
+  }
+
+  Ptr<DenmReceiver>
+  installReceiver(const std::string& node, Time start, Time stop)
+  {
+    AppHelper helper("ns3::ndn::DenmReceiver");
+    helper.SetAttribute("ReportFile", StringValue(TEST_REPORT.string()));
+    ApplicationContainer apps = helper.Install(getNode(node));
+    apps.Start(start);
+    apps.Stop(stop);
+    return DynamicCast<DenmReceiver>(apps.Get(0));
+  }
+
+  /**
+   * @brief Make a DENM of an event detected @p age ago
+   */
+  static shared_ptr<Data>
+  makeDenm(uint32_t appType, double x, double y, time::milliseconds age, uint64_t sequence,
+           bool isTermination = false)
+  {
+    DenmName denm;
+    denm.appType = appType;
+    denm.eventX = x;
+    denm.eventY = y;
+    denm.eventTime = time::duration_cast<time::milliseconds>(
+                       time::steady_clock::now().time_since_epoch()) - age;
+    denm.referenceTime = denm.eventTime;
+    denm.sequence = sequence;
+    denm.isTermination = isTermination;
+    return make_shared<Data>(denm.toName());
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnDenmReceiver, DenmReceiverFixture)
+
+BOOST_AUTO_TEST_CASE(DuplicatesAndRelevance)
+{
+  // without a mobility model, the vehicle stands at the origin
+  Ptr<DenmReceiver> receiver = installReceiver("1", Seconds(0.5), Seconds(2));
+
+  Simulator::Schedule(Seconds(1), MakeEvent([receiver] {
+    auto nearby = makeDenm(1, 50.0, 0.0, time::milliseconds(5), 1);
+    receiver->OnData(nearby);
+    receiver->OnData(nearby); // copy
+    DenmName denm;
+    BOOST_REQUIRE(DenmName::decode(nearby->getName(), denm));
+    denm.sequence = 2;
+    receiver->OnData(make_shared<Data>(denm.toName()));
+    receiver->OnData(nearby); // older than the last update
+
+    receiver->OnData(makeDenm(2, 1000.0, 0.0, time::milliseconds(5), 1)); // out of range
+    receiver->OnData(makeDenm(0, 0.0, 0.0, time::milliseconds(5), 3, true)); // ended unheard of
+
+    denm.sequence = 3;
+    denm.isTermination = true;
+    receiver->OnData(make_shared<Data>(denm.toName()));
+
+    receiver->OnData(make_shared<Data>("/not/a/denm"));
+  }));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  const DenmReceiver::Counters& counters = receiver->GetCounters();
+  BOOST_CHECK_EQUAL(counters.nEvents, 3);
+  BOOST_CHECK_EQUAL(counters.nRelevant, 1);
+  BOOST_CHECK_EQUAL(counters.nUpdates, 2);
+  BOOST_CHECK_EQUAL(counters.nDuplicates, 2);
+  BOOST_CHECK_EQUAL(counters.nTerminated, 2);
+
+  // only the first DENM of the relevant event is timed, in the histogram of its app type
+  BOOST_CHECK_EQUAL(receiver->GetLatencyHistogram(0).getCount(), 0);
+  BOOST_CHECK_EQUAL(receiver->GetLatencyHistogram(1).getCount(), 1);
+  BOOST_CHECK_EQUAL(receiver->GetLatencyHistogram(1).getMax(), 5000);
+  BOOST_CHECK_EQUAL(receiver->GetLatencyHistogram(2).getCount(), 0);
+
+  // the report is written on stop, one line per non-empty bucket
+  std::ifstream report(TEST_REPORT.string().c_str());
+  std::string header, line, extra;
+  BOOST_CHECK(std::getline(report, header));
+  BOOST_CHECK_EQUAL(header, "Node,AppType,LowerUs,UpperUs,Count");
+  BOOST_REQUIRE(std::getline(report, line));
+  BOOST_CHECK_EQUAL(line.substr(0, line.find(',', line.find(',') + 1)),
+                    std::to_string(getNode("1")->GetId()) + ",1");
+  BOOST_CHECK_EQUAL(line.substr(line.rfind(',')), ",1");
+  BOOST_CHECK(!std::getline(report, extra));
+}
+
+BOOST_AUTO_TEST_CASE(IsOnTrajectory)
+{
+  Vector origin(0.0, 0.0, 0.0);
+  Vector east(10.0, 0.0, 0.0);
+
+  BOOST_CHECK(DenmReceiver::IsOnTrajectory(origin, Vector(), Vector(150.0, 0.0, 0.0),
+                                           200.0, Seconds(30)));
+  BOOST_CHECK(!DenmReceiver::IsOnTrajectory(origin, Vector(), Vector(250.0, 0.0, 0.0),
+                                            200.0, Seconds(30)));
+  // ahead on the road, within the horizon
+  BOOST_CHECK(DenmReceiver::IsOnTrajectory(origin, east, Vector(250.0, 100.0, 0.0),
+                                           200.0, Seconds(30)));
+  // ahead, beyond the horizon
+  BOOST_CHECK(!DenmReceiver::IsOnTrajectory(origin, east, Vector(2500.0, 0.0, 0.0),
+                                            200.0, Seconds(30)));
+  // behind
+  BOOST_CHECK(!DenmReceiver::IsOnTrajectory(origin, east, Vector(-250.0, 0.0, 0.0),
+                                            200.0, Seconds(30)));
+}
+
+BOOST_AUTO_TEST_CASE(ForwardedDenm)
+{
+  StrategyChoiceHelper::InstallAll("/denm", "/localhost/nfd/strategy/denm-geo");
+
+  {
+    std::ofstream file(TEST_EVENTS.string().c_str());
+    file << "1.0,0,0,1,0,0.15\n";
+  }
+  AppHelper producerHelper("ns3::ndn::DenmProducer");
+  producerHelper.SetAttribute("Process", StringValue("trace"));
+  producerHelper.SetAttribute("TraceFile", StringValue(TEST_EVENTS.string()));
+  ApplicationContainer producer = producerHelper.Install(getNode("1"));
+  producer.Start(Seconds(0.5));
+  producer.Stop(Seconds(2));
+
+  Ptr<DenmReceiver> receiver = installReceiver("2", Seconds(0.5), Seconds(2));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // the forwarder delivers the DENM to the application face registered for /denm
+  BOOST_CHECK_EQUAL(receiver->GetCounters().nEvents, 1);
+  BOOST_CHECK_EQUAL(receiver->GetCounters().nRelevant, 1);
+  const LogHistogram& latencies = receiver->GetLatencyHistogram(1);
+  BOOST_REQUIRE_EQUAL(latencies.getCount(), 1);
+  BOOST_CHECK_GE(latencies.getMin(), 1000); // link delay
+  BOOST_CHECK_LT(latencies.getMax(), 20000); // temporal range of the DENM
+}
+
+BOOST_AUTO_TEST_CASE(ForwardedUpdates)
+{
+  StrategyChoiceHelper::InstallAll("/denm", "/localhost/nfd/strategy/denm-geo");
+
+  {
+    std::ofstream file(TEST_EVENTS.string().c_str());
+    file << "1.0,0,0,1,0,0.15\n";
+  }
+  AppHelper producerHelper("ns3::ndn::DenmProducer");
+  producerHelper.SetAttribute("Process", StringValue("trace"));
+  producerHelper.SetAttribute("TraceFile", StringValue(TEST_EVENTS.string()));
+  producerHelper.SetAttribute("RepetitionInterval", StringValue("100ms"));
+  ApplicationContainer producer = producerHelper.Install(getNode("1"));
+  producer.Start(Seconds(0.5));
+  producer.Stop(Seconds(2));
+
+  Ptr<DenmReceiver> receiver = installReceiver("2", Seconds(0.5), Seconds(2));
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // the repetition at 1.1s and the termination at 1.2s are long past the 20ms temporal range
+  // of the event time, but each is within the temporal range of its own reference time
+  BOOST_CHECK_EQUAL(receiver->GetCounters().nEvents, 1);
+  BOOST_CHECK_EQUAL(receiver->GetCounters().nUpdates, 2);
+  BOOST_CHECK_EQUAL(receiver->GetCounters().nTerminated, 1);
+  BOOST_CHECK_EQUAL(receiver->GetCounters().nDuplicates, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -62,6 +62,29 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
   BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(TestLinkType)
+{
+  NodeContainer nodes;
+  nodes.Create(3);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+  p2p.Install(nodes.Get(1), nodes.Get(2));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.Install(nodes.Get(0));
+  ndnHelper.SetLinkType(PointToPointNetDevice::GetTypeId(), ::ndn::nfd::LINK_TYPE_MULTI_ACCESS);
+  ndnHelper.Install(nodes.Get(2));
+
+  Ptr<L3Protocol> protoNode0 = L3Protocol::getL3Protocol(nodes.Get(0));
+  auto face0 = protoNode0->getFaceByNetDevice(nodes.Get(0)->GetDevice(0));
+  BOOST_CHECK_EQUAL(face0->getLinkType(), ::ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+
+  Ptr<L3Protocol> protoNode2 = L3Protocol::getL3Protocol(nodes.Get(2));
+  auto face2 = protoNode2->getFaceByNetDevice(nodes.Get(2)->GetDevice(0));
+  BOOST_CHECK_EQUAL(face2->getLinkType(), ::ndn::nfd::LINK_TYPE_MULTI_ACCESS);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
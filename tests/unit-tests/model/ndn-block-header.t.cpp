@@ -91,6 +91,31 @@ BOOST_AUTO_TEST_CASE(EncodePrintData)
   }
 }
 
+BOOST_AUTO_TEST_CASE(Deserialize)
+{
+  Data data("/other/prefix");
+  data.setContent(std::make_shared< ::ndn::Buffer>(300));
+  ndn::StackHelper::getKeyChain().sign(data);
+  lp::Packet lpPacket(data.wireEncode());
+  Block wire = lpPacket.wireEncode();
+
+  // bytes following the TLV element, such as link-layer padding, are not part of the block
+  const uint8_t padding[] = {0x00, 0x00, 0x00, 0x00};
+  Ptr<Packet> packet = Create<Packet>(padding, sizeof(padding));
+  packet->AddHeader(BlockHeader(wire));
+
+  BlockHeader header;
+  BOOST_CHECK_EQUAL(packet->PeekHeader(header), wire.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(header.getBlock().begin(), header.getBlock().end(),
+                                wire.begin(), wire.end());
+  BOOST_CHECK_EQUAL(packet->GetSize(), wire.size() + sizeof(padding));
+
+  // TLV-LENGTH exceeds the packet
+  const uint8_t truncated[] = {0x64, 0xfd, 0x01, 0x00, 0x50, 0x02};
+  Ptr<Packet> truncatedPacket = Create<Packet>(truncated, sizeof(truncated));
+  BOOST_CHECK_THROW(truncatedPacket->PeekHeader(header), ::ndn::tlv::Error);
+}
+
 BOOST_AUTO_TEST_CASE(PrintLpPacket)
 {
   Interest interest("/prefix");
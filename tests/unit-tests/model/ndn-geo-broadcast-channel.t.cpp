@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-geo-broadcast-channel.hpp"
+#include "model/ndn-geo-broadcast-net-device.hpp"
+#include "helper/ndn-geo-broadcast-helper.hpp"
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node-container.h"
+#include "ns3/simulator.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class GeoBroadcastChannelFixture : public CleanupFixture
+{
+public:
+  void
+  addNode(double x)
+  {
+    Ptr<Node> node = CreateObject<Node>();
+    Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel>();
+    mobility->SetPosition(Vector(x, 0, 0));
+    node->AggregateObject(mobility);
+    nodes.Add(node);
+  }
+
+  void
+  install()
+  {
+    // default Range of 250m
+    devices = GeoBroadcastHelper().Install(nodes);
+    for (auto device = devices.Begin(); device != devices.End(); ++device) {
+      (*device)->SetReceiveCallback(MakeCallback(&GeoBroadcastChannelFixture::onReceive, this));
+    }
+    nReceived.assign(devices.GetN(), 0);
+  }
+
+  void
+  send(uint32_t i)
+  {
+    Ptr<NetDevice> device = devices.Get(i);
+    device->Send(Create<Packet>(100), device->GetBroadcast(), 0x7777);
+  }
+
+  bool
+  onReceive(Ptr<NetDevice> device, Ptr<const Packet>, uint16_t, const Address&)
+  {
+    for (uint32_t i = 0; i < devices.GetN(); ++i) {
+      if (devices.Get(i) == device) {
+        ++nReceived[i];
+      }
+    }
+    return true;
+  }
+
+protected:
+  NodeContainer nodes;
+  NetDeviceContainer devices;
+  std::vector<int> nReceived;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnGeoBroadcastChannel, GeoBroadcastChannelFixture)
+
+BOOST_AUTO_TEST_CASE(Range)
+{
+  addNode(0);
+  addNode(100);
+  addNode(400);
+  install();
+
+  Simulator::Schedule(Seconds(1), &GeoBroadcastChannelFixture::send, this, 0);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nReceived[0], 0);
+  BOOST_CHECK_EQUAL(nReceived[1], 1);
+  BOOST_CHECK_EQUAL(nReceived[2], 0);
+}
+
+BOOST_AUTO_TEST_CASE(HiddenTerminalCollision)
+{
+  addNode(0);
+  addNode(200);
+  addNode(400);
+  install();
+
+  // the outer nodes cannot hear each other, so both frames overlap at the middle node
+  Simulator::Schedule(Seconds(1), &GeoBroadcastChannelFixture::send, this, 0);
+  Simulator::Schedule(Seconds(1) + MicroSeconds(50), &GeoBroadcastChannelFixture::send, this, 2);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nReceived[0], 0);
+  BOOST_CHECK_EQUAL(nReceived[1], 0);
+  BOOST_CHECK_EQUAL(nReceived[2], 0);
+}
+
+BOOST_AUTO_TEST_CASE(DeferWhileBusy)
+{
+  addNode(0);
+  addNode(100);
+  install();
+
+  // node 1 senses node 0's frame and defers its own transmission
+  Simulator::Schedule(Seconds(1), &GeoBroadcastChannelFixture::send, this, 0);
+  Simulator::Schedule(Seconds(1) + MicroSeconds(50), &GeoBroadcastChannelFixture::send, this, 1);
+  // back-to-back frames from one sender are serialized
+  Simulator::Schedule(Seconds(1.5), &GeoBroadcastChannelFixture::send, this, 0);
+  Simulator::Schedule(Seconds(1.5), &GeoBroadcastChannelFixture::send, this, 0);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nReceived[0], 1);
+  BOOST_CHECK_EQUAL(nReceived[1], 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
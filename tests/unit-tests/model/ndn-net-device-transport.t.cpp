@@ -0,0 +1,243 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-net-device-transport.hpp"
+#include "helper/ndn-geo-broadcast-helper.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node-container.h"
+#include "ns3/string.h"
+#include "ns3/wifi-helper.h"
+#include "ns3/wifi-mac-helper.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <algorithm>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class NetDeviceTransportFixture : public CleanupFixture
+{
+public:
+  NetDeviceTransportFixture()
+  {
+    // all three nodes are within range of each other
+    for (double x : {0.0, 100.0, 200.0}) {
+      Ptr<Node> node = CreateObject<Node>();
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel>();
+      mobility->SetPosition(Vector(x, 0, 0));
+      node->AggregateObject(mobility);
+      nodes.Add(node);
+    }
+    devices = GeoBroadcastHelper().Install(nodes);
+    StackHelper().Install(nodes);
+
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+      faces.push_back(L3Protocol::getL3Protocol(nodes.Get(i))->getFaceByNetDevice(devices.Get(i)));
+    }
+  }
+
+  void
+  sendData(uint32_t i, nfd::EndpointId endpoint)
+  {
+    Data data("/prefix/" + std::to_string(i));
+    StackHelper::getKeyChain().sign(data);
+    faces[i]->sendData(data, endpoint);
+  }
+
+  void
+  sendBurst()
+  {
+    for (int i = 0; i < 5; ++i) {
+      Data data("/background/" + std::to_string(i));
+      StackHelper::getKeyChain().sign(data);
+      faces[0]->sendData(data, 0);
+    }
+
+    Data urgent("/urgent");
+    urgent.setTag(make_shared<lp::PriorityTag>(0));
+    StackHelper::getKeyChain().sign(urgent);
+    faces[0]->sendData(urgent, 0);
+
+    auto transport = dynamic_cast<NetDeviceTransport*>(faces[0]->getTransport());
+    // one frame is on the air and one waits in the device
+    BOOST_CHECK_EQUAL(transport->getEgressQueue()->size(0), 1);
+    BOOST_CHECK_EQUAL(transport->getEgressQueue()->size(PriorityEgressQueue::N_CLASSES - 1), 3);
+  }
+
+  void
+  OnInData(const Data& data, const Face&)
+  {
+    receivedNames.push_back(data.getName());
+  }
+
+  uint64_t
+  getNInData(uint32_t i)
+  {
+    return L3Protocol::getL3Protocol(nodes.Get(i))->getForwarder()->getCounters().nInData;
+  }
+
+protected:
+  NodeContainer nodes;
+  NetDeviceContainer devices;
+  std::vector<shared_ptr<Face>> faces;
+  std::vector<Name> receivedNames;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnNetDeviceTransport, NetDeviceTransportFixture)
+
+BOOST_AUTO_TEST_CASE(UnicastToNeighbor)
+{
+  BOOST_CHECK_EQUAL(faces[0]->getLinkType(), ::ndn::nfd::LINK_TYPE_AD_HOC);
+  auto transport = dynamic_cast<NetDeviceTransport*>(faces[0]->getTransport());
+  BOOST_REQUIRE(transport != nullptr);
+
+  // node 0 learns node 1 from a broadcast
+  Simulator::Schedule(Seconds(1), &NetDeviceTransportFixture::sendData, this, 1, 0);
+  Simulator::Stop(Seconds(1.5));
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(transport->getNeighbors().size(), 1);
+  auto neighbor = *transport->getNeighbors().begin();
+  BOOST_CHECK(neighbor.second.address == devices.Get(1)->GetAddress());
+  BOOST_CHECK_EQUAL(getNInData(0), 1);
+  BOOST_CHECK_EQUAL(getNInData(2), 1);
+
+  // a packet to node 1's endpoint is not delivered to node 2
+  Simulator::Schedule(Seconds(0.5), &NetDeviceTransportFixture::sendData, this, 0, neighbor.first);
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(getNInData(1), 1);
+  BOOST_CHECK_EQUAL(getNInData(2), 1);
+}
+
+BOOST_AUTO_TEST_CASE(UrgentFirst)
+{
+  auto transport = dynamic_cast<NetDeviceTransport*>(faces[0]->getTransport());
+  BOOST_REQUIRE(transport != nullptr);
+  BOOST_REQUIRE(transport->getEgressQueue() != nullptr);
+
+  L3Protocol::getL3Protocol(nodes.Get(1))->TraceConnectWithoutContext("InData",
+    MakeCallback(&NetDeviceTransportFixture::OnInData, this));
+
+  Simulator::Schedule(Seconds(1), &NetDeviceTransportFixture::sendBurst, this);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  // the urgent Data overtakes the background Data that had not reached the device yet
+  BOOST_REQUIRE_EQUAL(receivedNames.size(), 6);
+  BOOST_CHECK_EQUAL(receivedNames[2], Name("/urgent"));
+  BOOST_CHECK(transport->getEgressQueue()->empty());
+  BOOST_CHECK_EQUAL(transport->getEgressQueue()->getCounters(0).nEnqueued, 1);
+  BOOST_CHECK_EQUAL(transport->getEgressQueue()->getCounters(0).nDropped, 0);
+}
+
+class WifiTransportFixture : public CleanupFixture
+{
+public:
+  WifiTransportFixture()
+  {
+    for (double x : {0.0, 10.0}) {
+      Ptr<Node> node = CreateObject<Node>();
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel>();
+      mobility->SetPosition(Vector(x, 0, 0));
+      node->AggregateObject(mobility);
+      wifiNodes.Add(node);
+    }
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_PHY_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager", "DataMode",
+                                 StringValue("OfdmRate24Mbps"));
+    YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default();
+    wifiPhy.SetChannel(YansWifiChannelHelper::Default().Create());
+    WifiMacHelper wifiMac;
+    wifiMac.SetType("ns3::AdhocWifiMac");
+    wifiDevices = wifi.Install(wifiPhy, wifiMac, wifiNodes);
+    StackHelper().Install(wifiNodes);
+
+    for (uint32_t i = 0; i < wifiNodes.GetN(); ++i) {
+      wifiFaces.push_back(L3Protocol::getL3Protocol(wifiNodes.Get(i))
+                            ->getFaceByNetDevice(wifiDevices.Get(i)));
+    }
+  }
+
+  void
+  sendWifiBurst()
+  {
+    for (int i = 0; i < 5; ++i) {
+      Data data("/background/" + std::to_string(i));
+      StackHelper::getKeyChain().sign(data);
+      wifiFaces[0]->sendData(data, 0);
+    }
+
+    Data urgent("/urgent");
+    urgent.setTag(make_shared<lp::PriorityTag>(0));
+    StackHelper::getKeyChain().sign(urgent);
+    wifiFaces[0]->sendData(urgent, 0);
+  }
+
+  void
+  OnInData(const Data& data, const Face&)
+  {
+    receivedNames.push_back(data.getName());
+  }
+
+protected:
+  NodeContainer wifiNodes;
+  NetDeviceContainer wifiDevices;
+  std::vector<shared_ptr<Face>> wifiFaces;
+  std::vector<Name> receivedNames;
+};
+
+BOOST_FIXTURE_TEST_CASE(WifiUrgentFirst, WifiTransportFixture)
+{
+  BOOST_CHECK_EQUAL(wifiFaces[0]->getLinkType(), ::ndn::nfd::LINK_TYPE_AD_HOC);
+  auto transport = dynamic_cast<NetDeviceTransport*>(wifiFaces[0]->getTransport());
+  BOOST_REQUIRE(transport != nullptr);
+  BOOST_REQUIRE(transport->getEgressQueue() != nullptr);
+  BOOST_CHECK_GE(transport->getSendQueueLength(), 0);
+
+  L3Protocol::getL3Protocol(wifiNodes.Get(1))->TraceConnectWithoutContext("InData",
+    MakeCallback(&WifiTransportFixture::OnInData, this));
+
+  Simulator::Schedule(Seconds(1), &WifiTransportFixture::sendWifiBurst, this);
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  // the Txop queue holds at most one frame besides the one being transmitted, so the urgent
+  // Data overtakes at least three of the background Data
+  BOOST_REQUIRE_EQUAL(receivedNames.size(), 6);
+  auto urgent = std::find(receivedNames.begin(), receivedNames.end(), Name("/urgent"));
+  BOOST_CHECK_LE(std::distance(receivedNames.begin(), urgent), 2);
+  BOOST_CHECK(transport->getEgressQueue()->empty());
+  BOOST_CHECK_EQUAL(transport->getEgressQueue()->getCounters(0).nEnqueued, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-position-cache.hpp"
+
+#include "ns3/constant-velocity-mobility-model.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief A stationary mobility model that counts how often its position is computed
+ */
+class CountingMobilityModel : public MobilityModel
+{
+public:
+  size_t
+  getNComputed() const
+  {
+    return m_nComputed;
+  }
+
+private:
+  Vector
+  DoGetPosition() const override
+  {
+    ++m_nComputed;
+    return m_position;
+  }
+
+  void
+  DoSetPosition(const Vector& position) override
+  {
+    m_position = position;
+    NotifyCourseChange();
+  }
+
+  Vector
+  DoGetVelocity() const override
+  {
+    return Vector();
+  }
+
+private:
+  Vector m_position;
+  mutable size_t m_nComputed = 0;
+};
+
+class PositionCacheFixture : public CleanupFixture
+{
+public:
+  PositionCacheFixture()
+    : mobility(CreateObject<ConstantVelocityMobilityModel>())
+  {
+    mobility->SetPosition(Vector(10.0, 20.0, 0.0));
+    cache.attach(mobility);
+  }
+
+protected:
+  Ptr<ConstantVelocityMobilityModel> mobility;
+  PositionCache cache;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnPositionCache, PositionCacheFixture)
+
+BOOST_AUTO_TEST_CASE(FollowCourseChange)
+{
+  BOOST_CHECK(cache.isAttached());
+  BOOST_CHECK_EQUAL(cache.getPosition(), Vector(10.0, 20.0, 0.0));
+
+  mobility->SetPosition(Vector(30.0, 40.0, 0.0));
+  BOOST_CHECK_EQUAL(cache.getPosition(), Vector(30.0, 40.0, 0.0));
+
+  Simulator::Schedule(Seconds(1), MakeEvent([this] {
+    mobility->SetVelocity(Vector(2.0, -1.0, 0.0));
+    BOOST_CHECK_EQUAL(cache.getVelocity(), Vector(2.0, -1.0, 0.0));
+  }));
+  Simulator::Schedule(Seconds(3), MakeEvent([this] {
+    // extrapolated from the course change at 1s
+    BOOST_CHECK_EQUAL(cache.getPosition(), Vector(34.0, 38.0, 0.0));
+    BOOST_CHECK_EQUAL(cache.getPosition(), mobility->GetPosition());
+  }));
+  Simulator::Schedule(Seconds(4), MakeEvent([this] {
+    mobility->SetVelocity(Vector(0.0, 0.0, 0.0));
+  }));
+  Simulator::Schedule(Seconds(10), MakeEvent([this] {
+    BOOST_CHECK_EQUAL(cache.getPosition(), Vector(36.0, 37.0, 0.0));
+    BOOST_CHECK_EQUAL(cache.getVelocity(), Vector(0.0, 0.0, 0.0));
+  }));
+
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_CASE(ReadWithoutRecompute)
+{
+  Ptr<CountingMobilityModel> counting = CreateObject<CountingMobilityModel>();
+  counting->SetPosition(Vector(1.0, 2.0, 0.0));
+
+  PositionCache countingCache;
+  countingCache.attach(counting);
+  size_t nComputed = counting->getNComputed();
+  BOOST_CHECK_EQUAL(nComputed, 1);
+
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK_EQUAL(countingCache.getPosition(), Vector(1.0, 2.0, 0.0));
+  }
+  countingCache.getGeoTag();
+  BOOST_CHECK_EQUAL(counting->getNComputed(), nComputed);
+
+  // a course change is read once
+  counting->SetPosition(Vector(5.0, 6.0, 0.0));
+  BOOST_CHECK_EQUAL(counting->getNComputed(), nComputed + 1);
+  BOOST_CHECK_EQUAL(countingCache.getPosition(), Vector(5.0, 6.0, 0.0));
+  BOOST_CHECK_EQUAL(counting->getNComputed(), nComputed + 1);
+
+  // a detached cache no longer follows the model
+  countingCache.detach();
+  BOOST_CHECK(!countingCache.isAttached());
+  counting->SetPosition(Vector(7.0, 8.0, 0.0));
+  BOOST_CHECK_EQUAL(counting->getNComputed(), nComputed + 1);
+  BOOST_CHECK_EQUAL(countingCache.getPosition(), Vector(0.0, 0.0, 0.0));
+}
+
+BOOST_AUTO_TEST_CASE(GeoTag)
+{
+  shared_ptr<const lp::GeoTag> stationary = cache.getGeoTag();
+  BOOST_REQUIRE(stationary != nullptr);
+  BOOST_CHECK_CLOSE(stationary->getX(), 10.0, 0.001);
+  BOOST_CHECK_CLOSE(stationary->getY(), 20.0, 0.001);
+  BOOST_CHECK(cache.getGeoTag() == stationary);
+
+  shared_ptr<const lp::GeoTag> moving;
+  Simulator::Schedule(Seconds(1), MakeEvent([&] {
+    // a stationary node keeps its tag over time
+    BOOST_CHECK(cache.getGeoTag() == stationary);
+
+    // a course change discards the tag, even if the position is the same
+    mobility->SetVelocity(Vector(1.0, 0.0, 0.0));
+    moving = cache.getGeoTag();
+    BOOST_CHECK(moving != stationary);
+    BOOST_CHECK_CLOSE(moving->getX(), 10.0, 0.001);
+    BOOST_CHECK(cache.getGeoTag() == moving);
+  }));
+  Simulator::Schedule(Seconds(1.000001), MakeEvent([&] {
+    // the node has moved less than the resolution of the GeoTag
+    BOOST_CHECK(cache.getGeoTag() == moving);
+  }));
+  Simulator::Schedule(Seconds(2), MakeEvent([&] {
+    shared_ptr<const lp::GeoTag> moved = cache.getGeoTag();
+    BOOST_CHECK(moved != moving);
+    BOOST_CHECK_CLOSE(moved->getX(), 11.0, 0.001);
+    BOOST_CHECK_CLOSE(moved->getY(), 20.0, 0.001);
+
+    // the encoding is reused by the LpPacket field
+    BOOST_CHECK(moved->wireEncode() == lp::GeoTag(11.0, 20.0).wireEncode());
+  }));
+
+  Simulator::Run();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
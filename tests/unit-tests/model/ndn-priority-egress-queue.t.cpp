@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-priority-egress-queue.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(ModelNdnPriorityEgressQueue)
+
+static Block
+makeLpPacket(::ndn::optional<uint64_t> priority)
+{
+  static const uint8_t payload[] = {0x05, 0x00}; // empty Interest TLV, enough for the queue
+  lp::Packet pkt;
+  pkt.add<lp::FragmentField>({std::begin(payload), std::end(payload)});
+  if (priority) {
+    pkt.add<lp::PriorityField>(*priority);
+  }
+  return pkt.wireEncode();
+}
+
+BOOST_AUTO_TEST_CASE(Classify)
+{
+  BOOST_CHECK_EQUAL(PriorityEgressQueue::classify(makeLpPacket(0)), 0);
+  BOOST_CHECK_EQUAL(PriorityEgressQueue::classify(makeLpPacket(2)), 2);
+  BOOST_CHECK_EQUAL(PriorityEgressQueue::classify(makeLpPacket(9)),
+                    PriorityEgressQueue::N_CLASSES - 1);
+  BOOST_CHECK_EQUAL(PriorityEgressQueue::classify(makeLpPacket(::ndn::nullopt)),
+                    PriorityEgressQueue::N_CLASSES - 1);
+  BOOST_CHECK_EQUAL(PriorityEgressQueue::classify(::ndn::makeNonNegativeIntegerBlock(5, 1)),
+                    PriorityEgressQueue::N_CLASSES - 1);
+}
+
+BOOST_AUTO_TEST_CASE(StrictPriority)
+{
+  PriorityEgressQueue queue;
+  BOOST_CHECK(queue.enqueue(makeLpPacket(3), 1));
+  BOOST_CHECK(queue.enqueue(makeLpPacket(1), 2));
+  BOOST_CHECK(queue.enqueue(makeLpPacket(0), 3));
+  BOOST_CHECK(queue.enqueue(makeLpPacket(1), 4));
+  BOOST_CHECK_EQUAL(queue.size(), 4);
+  BOOST_CHECK_EQUAL(queue.getNBytes(), 4 * makeLpPacket(0).size());
+
+  std::vector<nfd::EndpointId> order;
+  while (!queue.empty()) {
+    order.push_back(queue.dequeue().endpoint);
+  }
+  std::vector<nfd::EndpointId> expected{3, 2, 4, 1};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(queue.getNBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Limit)
+{
+  PriorityEgressQueue queue;
+  queue.setLimit(3, 2);
+  BOOST_CHECK(queue.enqueue(makeLpPacket(::ndn::nullopt), 0));
+  BOOST_CHECK(queue.enqueue(makeLpPacket(::ndn::nullopt), 0));
+  BOOST_CHECK(!queue.enqueue(makeLpPacket(::ndn::nullopt), 0));
+
+  // a full background class does not hold back urgent packets
+  BOOST_CHECK(queue.enqueue(makeLpPacket(0), 0));
+
+  BOOST_CHECK_EQUAL(queue.getCounters(3).nEnqueued, 2);
+  BOOST_CHECK_EQUAL(queue.getCounters(3).nDropped, 1);
+  BOOST_CHECK_EQUAL(queue.getCounters(0).nEnqueued, 1);
+  BOOST_CHECK_EQUAL(queue.getCounters(0).nDropped, 0);
+  BOOST_CHECK_EQUAL(queue.size(3), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
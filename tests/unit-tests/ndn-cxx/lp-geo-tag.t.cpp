@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/lp/geo-tag.hpp>
+#include <ndn-cxx/lp/packet.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::lp::GeoTag;
+
+BOOST_AUTO_TEST_SUITE(LpGeoTag)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode2d)
+{
+  GeoTag tag(1234.567, -89.012);
+  BOOST_CHECK(!tag.hasZ());
+  BOOST_CHECK(!tag.hasMotion());
+
+  const Block& wire = tag.wireEncode();
+  BOOST_CHECK_EQUAL(wire.size(), 11);
+
+  GeoTag decoded(wire);
+  BOOST_CHECK_CLOSE(decoded.getX(), 1234.57, 0.0001);
+  BOOST_CHECK_CLOSE(decoded.getY(), -89.01, 0.0001);
+  BOOST_CHECK_EQUAL(decoded.getZ(), 0.0);
+  BOOST_CHECK(!decoded.hasZ());
+  BOOST_CHECK(!decoded.hasMotion());
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDecode3dMotion)
+{
+  GeoTag tag(std::make_tuple(10.0, 20.0, -3.5));
+  tag.setMotion(-90.0, 27.78);
+  BOOST_CHECK_EQUAL(tag.wireEncode().size(), 19);
+
+  GeoTag decoded(tag.wireEncode());
+  BOOST_CHECK(decoded.hasZ());
+  BOOST_CHECK_EQUAL(decoded.getZ(), -3.5);
+  BOOST_CHECK(decoded.hasMotion());
+  BOOST_CHECK_CLOSE(decoded.getHeading(), 270.0, 0.0001);
+  BOOST_CHECK_CLOSE(decoded.getSpeed(), 27.78, 0.0001);
+
+  decoded.unsetMotion().setPos(1.0, 2.0);
+  BOOST_CHECK_EQUAL(decoded.wireEncode().size(), 11);
+}
+
+BOOST_AUTO_TEST_CASE(LpPacketField)
+{
+  GeoTag tag(5.0, 6.0);
+
+  ::ndn::lp::Packet packet;
+  packet.add<::ndn::lp::GeoTagField>(tag);
+  GeoTag decoded = packet.get<::ndn::lp::GeoTagField>();
+  BOOST_CHECK_EQUAL(decoded.getX(), 5.0);
+  BOOST_CHECK_EQUAL(decoded.getY(), 6.0);
+
+  tag.setPos(7.0, 8.0);
+  BOOST_CHECK_EQUAL(GeoTag(tag.wireEncode()).getX(), 7.0);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  BOOST_CHECK_THROW(GeoTag(3.0e7, 0.0), std::invalid_argument);
+  BOOST_CHECK_THROW(GeoTag(0.0, 0.0).setMotion(0.0, -1.0), std::invalid_argument);
+
+  const uint8_t truncated[] = {0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01};
+  BOOST_CHECK_THROW(GeoTag(Block(truncated, sizeof(truncated))), GeoTag::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-data-template.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsDataTemplate)
+
+BOOST_AUTO_TEST_CASE(ZeroPayload)
+{
+  auto payload = DataTemplate::getZeroPayload(1200);
+  BOOST_CHECK_EQUAL(payload->size(), 1200);
+  BOOST_CHECK(std::all_of(payload->begin(), payload->end(), [] (uint8_t b) { return b == 0; }));
+  BOOST_CHECK_EQUAL(DataTemplate::getZeroPayload(1200), payload);
+  BOOST_CHECK_NE(DataTemplate::getZeroPayload(100), payload);
+}
+
+BOOST_AUTO_TEST_CASE(SameAsEncoded)
+{
+  Data expected("/prefix/A/%01");
+  expected.setFreshnessPeriod(time::milliseconds(2000));
+  expected.setContent(make_shared<::ndn::Buffer>(1200));
+  SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
+  signatureInfo.setKeyLocator(Name("/key"));
+  Signature signature;
+  signature.setInfo(signatureInfo);
+  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 7));
+  expected.setSignature(signature);
+
+  DataTemplate dataTemplate(1200, 7, "/key");
+  auto data = dataTemplate.makeData("/prefix/A/%01", time::milliseconds(2000));
+  BOOST_CHECK(data->hasWire());
+  BOOST_CHECK_EQUAL(data->getName(), "/prefix/A/%01");
+  BOOST_CHECK_EQUAL(data->getFreshnessPeriod(), time::milliseconds(2000));
+  BOOST_CHECK_EQUAL(data->getContent().value_size(), 1200);
+  const Block& wire = data->wireEncode();
+  const Block& expectedWire = expected.wireEncode();
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), expectedWire.begin(), expectedWire.end());
+
+  // without freshness, the MetaInfo is empty
+  auto unlimited = dataTemplate.makeData("/prefix/B", time::milliseconds(0));
+  BOOST_CHECK_EQUAL(unlimited->getFreshnessPeriod(), time::milliseconds(0));
+  BOOST_CHECK_EQUAL(unlimited->getName(), "/prefix/B");
+}
+
+BOOST_AUTO_TEST_CASE(FromPrototype)
+{
+  Data prototype("/prototype");
+  prototype.setContent(DataTemplate::getZeroPayload(10));
+  Signature signature;
+  signature.setInfo(SignatureInfo(::ndn::tlv::DigestSha256));
+  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+  prototype.setSignature(signature);
+
+  DataTemplate dataTemplate(prototype);
+  auto data = dataTemplate.makeData("/other", time::milliseconds(10));
+  BOOST_CHECK_EQUAL(data->getName(), "/other");
+  BOOST_CHECK_EQUAL(data->getContent(), prototype.getContent());
+  BOOST_CHECK_EQUAL(data->getSignature().getType(), static_cast<uint32_t>(::ndn::tlv::DigestSha256));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-log-histogram.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsLogHistogram)
+
+BOOST_AUTO_TEST_CASE(Buckets)
+{
+  for (uint64_t value = 0; value < 100000; ++value) {
+    size_t index = LogHistogram::getIndex(value);
+    BOOST_REQUIRE_LE(LogHistogram::getLowerBound(index), value);
+    BOOST_REQUIRE_GT(LogHistogram::getLowerBound(index + 1), value);
+  }
+
+  // small values are exact, larger ones are within 1/8 of their lower bound
+  BOOST_CHECK_EQUAL(LogHistogram::getIndex(15), 15);
+  BOOST_CHECK_EQUAL(LogHistogram::getLowerBound(LogHistogram::getIndex(1000)), 960);
+  BOOST_CHECK_EQUAL(LogHistogram::getLowerBound(LogHistogram::getIndex(1000) + 1), 1024);
+}
+
+BOOST_AUTO_TEST_CASE(Statistics)
+{
+  LogHistogram histogram;
+  BOOST_CHECK_EQUAL(histogram.getCount(), 0);
+  BOOST_CHECK_EQUAL(histogram.getQuantile(0.5), 0);
+
+  for (uint64_t value = 1; value <= 1000; ++value) {
+    histogram.add(value);
+  }
+  BOOST_CHECK_EQUAL(histogram.getCount(), 1000);
+  BOOST_CHECK_EQUAL(histogram.getMin(), 1);
+  BOOST_CHECK_EQUAL(histogram.getMax(), 1000);
+  BOOST_CHECK_CLOSE(histogram.getMean(), 500.5, 0.001);
+  BOOST_CHECK_EQUAL(histogram.getQuantile(0.5), 511);
+  BOOST_CHECK_EQUAL(histogram.getQuantile(1.0), 1000);
+
+  uint64_t total = 0;
+  uint64_t previousUpper = 0;
+  histogram.forEachBucket([&] (uint64_t lower, uint64_t upper, uint64_t count) {
+    BOOST_CHECK_GE(lower, previousUpper);
+    BOOST_CHECK_LT(lower, upper);
+    previousUpper = upper;
+    total += count;
+  });
+  BOOST_CHECK_EQUAL(total, 1000);
+
+  LogHistogram other;
+  other.add(5000);
+  histogram.merge(other);
+  BOOST_CHECK_EQUAL(histogram.getCount(), 1001);
+  BOOST_CHECK_EQUAL(histogram.getMax(), 5000);
+  BOOST_CHECK_EQUAL(histogram.getMin(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-outstanding-interest-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsOutstandingInterestTable)
+
+BOOST_AUTO_TEST_CASE(Transmissions)
+{
+  OutstandingInterestTable table;
+  BOOST_CHECK(table.find(1) == nullptr);
+  BOOST_CHECK(table.getEarliestArmed() == nullptr);
+
+  table.transmit(1, Seconds(1));
+  table.transmit(1, Seconds(2)); // timer still armed from the first transmission
+  const OutstandingInterestTable::Entry* entry = table.find(1);
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_CHECK_EQUAL(entry->firstSent, Seconds(1));
+  BOOST_CHECK_EQUAL(entry->lastSent, Seconds(2));
+  BOOST_CHECK_EQUAL(entry->armedAt, Seconds(1));
+  BOOST_CHECK_EQUAL(entry->nTransmissions, 2);
+
+  BOOST_CHECK_EQUAL(table.disarmEarliest(), 1);
+  BOOST_CHECK(table.getEarliestArmed() == nullptr);
+
+  // a retransmission re-arms the timer, keeping the first transmission time
+  table.transmit(1, Seconds(3));
+  BOOST_REQUIRE(table.getEarliestArmed() == table.find(1));
+  BOOST_CHECK_EQUAL(entry->firstSent, Seconds(1));
+  BOOST_CHECK_EQUAL(entry->armedAt, Seconds(3));
+  BOOST_CHECK_EQUAL(entry->nTransmissions, 3);
+
+  table.erase(1);
+  BOOST_CHECK(table.find(1) == nullptr);
+  BOOST_CHECK(table.getEarliestArmed() == nullptr);
+  BOOST_CHECK_EQUAL(table.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TimerOrder)
+{
+  OutstandingInterestTable table(4);
+  for (uint32_t seq = 0; seq < 100; ++seq) {
+    table.transmit(seq, MilliSeconds(seq));
+  }
+  BOOST_CHECK_EQUAL(table.size(), 100);
+  BOOST_CHECK_EQUAL(table.getCapacity(), 256);
+
+  for (uint32_t seq = 0; seq < 100; seq += 2) {
+    table.erase(seq);
+  }
+  table.transmit(3, MilliSeconds(100)); // already armed, keeps its place
+  table.transmit(200, MilliSeconds(100));
+
+  for (uint32_t seq = 1; seq < 100; seq += 2) {
+    BOOST_REQUIRE(table.getEarliestArmed() != nullptr);
+    BOOST_CHECK_EQUAL(table.getEarliestArmed()->armedAt, MilliSeconds(seq));
+    BOOST_CHECK_EQUAL(table.disarmEarliest(), seq);
+  }
+  BOOST_CHECK_EQUAL(table.disarmEarliest(), 200);
+  BOOST_CHECK(table.getEarliestArmed() == nullptr);
+  BOOST_CHECK_EQUAL(table.size(), 51);
+}
+
+BOOST_AUTO_TEST_CASE(Collisions)
+{
+  // sequence numbers with the same home slot form one probe run
+  OutstandingInterestTable table(16);
+  std::vector<uint32_t> seqs{5, 21, 37, 6, 53, 7};
+  for (uint32_t seq : seqs) {
+    table.transmit(seq, Seconds(seq));
+  }
+  BOOST_CHECK_EQUAL(table.getCapacity(), 16);
+
+  table.erase(21);
+  table.erase(5);
+  for (uint32_t seq : {37, 6, 53, 7}) {
+    BOOST_REQUIRE(table.find(seq) != nullptr);
+    BOOST_CHECK_EQUAL(table.find(seq)->seq, seq);
+    BOOST_CHECK_EQUAL(table.find(seq)->firstSent, Seconds(seq));
+  }
+
+  for (uint32_t seq : {37, 6, 53, 7}) {
+    BOOST_CHECK_EQUAL(table.disarmEarliest(), seq);
+  }
+  BOOST_CHECK(table.find(5) == nullptr);
+  BOOST_CHECK(table.find(21) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
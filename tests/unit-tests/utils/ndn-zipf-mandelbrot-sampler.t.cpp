@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-zipf-mandelbrot-sampler.hpp"
+
+#include <cmath>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsZipfMandelbrotSampler)
+
+BOOST_AUTO_TEST_CASE(Probabilities)
+{
+  ZipfMandelbrotSampler sampler(100, 0.7, 0.7);
+  BOOST_CHECK_EQUAL(sampler.getN(), 100);
+
+  double sum = 0.0;
+  for (uint32_t k = 1; k <= 100; ++k) {
+    sum += sampler.getProbability(k);
+    if (k > 1) {
+      BOOST_CHECK_LT(sampler.getProbability(k), sampler.getProbability(k - 1));
+    }
+  }
+  BOOST_CHECK_CLOSE(sum, 1.0, 1e-9);
+  BOOST_CHECK_CLOSE(sampler.getProbability(1) / sampler.getProbability(2),
+                    std::pow((2 + 0.7) / (1 + 0.7), 0.7), 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(Distribution)
+{
+  ZipfMandelbrotSampler sampler(50, 0.0, 1.0);
+
+  // stepping u evenly over [0, 1) hits every alias column equally often, so the
+  // empirical frequencies match the probabilities up to the step size
+  const uint32_t nSteps = 1000000;
+  std::vector<uint32_t> counts(51, 0);
+  for (uint32_t i = 0; i < nSteps; ++i) {
+    uint32_t k = sampler.sample((i + 0.5) / nSteps);
+    BOOST_REQUIRE_GE(k, 1);
+    BOOST_REQUIRE_LE(k, 50);
+    ++counts[k];
+  }
+
+  for (uint32_t k = 1; k <= 50; ++k) {
+    BOOST_CHECK_SMALL(static_cast<double>(counts[k]) / nSteps - sampler.getProbability(k), 1e-4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Bounds)
+{
+  ZipfMandelbrotSampler sampler(10, 0.7, 0.7);
+  BOOST_CHECK_GE(sampler.sample(0.0), 1);
+  BOOST_CHECK_LE(sampler.sample(0.0), 10);
+  BOOST_CHECK_GE(sampler.sample(0.999999999999), 1);
+  BOOST_CHECK_LE(sampler.sample(0.999999999999), 10);
+
+  ZipfMandelbrotSampler single(1, 0.7, 0.7);
+  BOOST_CHECK_EQUAL(single.sample(0.0), 1);
+  BOOST_CHECK_EQUAL(single.sample(0.5), 1);
+  BOOST_CHECK_CLOSE(single.getProbability(1), 1.0, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(Sharing)
+{
+  auto a = ZipfMandelbrotSampler::get(1000, 0.7, 0.7);
+  auto b = ZipfMandelbrotSampler::get(1000, 0.7, 0.7);
+  auto c = ZipfMandelbrotSampler::get(1000, 0.7, 0.8);
+  BOOST_CHECK_EQUAL(a, b);
+  BOOST_CHECK_NE(a, c);
+  BOOST_CHECK_EQUAL(c->getN(), 1000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
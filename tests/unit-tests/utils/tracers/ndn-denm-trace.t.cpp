@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-denm-trace.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_DENM_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "denm-trace.bin";
+
+class DenmTraceFixture : public CleanupFixture
+{
+public:
+  DenmTraceFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+  }
+
+  ~DenmTraceFixture()
+  {
+    DenmTrace::Close();
+    boost::filesystem::remove(TEST_DENM_TRACE);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnDenmTrace, DenmTraceFixture)
+
+BOOST_AUTO_TEST_CASE(RecordAndConvert)
+{
+  // a small buffer forces records to be flushed while tracing
+  DenmTrace::Open(TEST_DENM_TRACE.string(), DenmTrace::LEVEL_DECISION, 64);
+  BOOST_CHECK_EQUAL(DenmTrace::GetLevel(), DenmTrace::LEVEL_DECISION);
+
+  Simulator::Schedule(Seconds(1), MakeEvent([] {
+    DenmTrace::Record(3, DenmTrace::Decision::PRODUCED, 42, 0.0);
+    DenmTrace::Record(4, DenmTrace::Decision::SCHEDULED, 42, 120.5, time::microseconds(1500));
+    DenmTrace::Record(4, DenmTrace::Decision::DUPLICATE, 42, 120.5); // above LEVEL_DECISION
+  }));
+  Simulator::Schedule(Seconds(2), MakeEvent([] {
+    DenmTrace::Record(4, DenmTrace::Decision::REBROADCAST, 42, 121.0);
+  }));
+  Simulator::Run();
+
+  DenmTrace::Close();
+  BOOST_CHECK_EQUAL(DenmTrace::GetLevel(), DenmTrace::LEVEL_NONE);
+
+  std::ostringstream os;
+  BOOST_CHECK_EQUAL(DenmTrace::ConvertToCsv(TEST_DENM_TRACE.string(), os), 3);
+  BOOST_CHECK_EQUAL(os.str(),
+    R"STR(TimeNS,Node,EventId,Decision,Distance,TimerNS
+1000000000,3,42,produced,0,
+1000000000,4,42,scheduled,120.5,1500000
+2000000000,4,42,rebroadcast,121,
+)STR");
+}
+
+BOOST_AUTO_TEST_CASE(Level)
+{
+  BOOST_CHECK_EQUAL(DenmTrace::IsEnabled(DenmTrace::Decision::PRODUCED), false);
+  DenmTrace::SetLevel(DenmTrace::LEVEL_ALL); // no effect while closed
+  BOOST_CHECK_EQUAL(DenmTrace::GetLevel(), DenmTrace::LEVEL_NONE);
+
+  DenmTrace::Open(TEST_DENM_TRACE.string(), DenmTrace::LEVEL_APP);
+  BOOST_CHECK_EQUAL(DenmTrace::IsEnabled(DenmTrace::Decision::CONSUMED), true);
+  BOOST_CHECK_EQUAL(DenmTrace::IsEnabled(DenmTrace::Decision::CANCELLED), false);
+
+  DenmTrace::SetLevel(DenmTrace::LEVEL_ALL);
+  BOOST_CHECK_EQUAL(DenmTrace::IsEnabled(DenmTrace::Decision::OUT_OF_SCOPE), true);
+}
+
+BOOST_AUTO_TEST_CASE(NotATrace)
+{
+  {
+    std::ofstream os(TEST_DENM_TRACE.string().c_str());
+    os << "Time\tNode\n";
+  }
+  std::ostringstream os;
+  BOOST_CHECK_THROW(DenmTrace::ConvertToCsv(TEST_DENM_TRACE.string(), os), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-denm-tracer.hpp"
+#include "helper/ndn-app-helper.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_EVENTS = boost::filesystem::path(TEST_CONFIG_PATH) / "events.csv";
+
+class DenmTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  DenmTracerFixture()
+  {
+    // DENMs are only accepted within DenmScopeTable::DEFAULT_SCOPE's 20ms temporal range
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+    Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("20p"));
+
+    createTopology({
+        {"1", "2"},
+        {"2", "3"}
+      });
+
+    StrategyChoiceHelper::InstallAll("/denm", "/localhost/nfd/strategy/denm-geo");
+
+    addApps({
+        {"1", "ns3::ndn::Producer",
+            {{"Prefix", "/denm"}, {"PayloadSize", "100"}, {"AdvTransmissionInterval", "10000"}},
+            "1s", "2s"} // push just one DENM
+      });
+  }
+
+  ~DenmTracerFixture()
+  {
+    DenmTracer::Destroy();
+    boost::filesystem::remove(TEST_EVENTS);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnDenmTracer, DenmTracerFixture)
+
+BOOST_AUTO_TEST_CASE(Dissemination)
+{
+  auto output = make_shared<std::ostringstream>();
+  Ptr<DenmTracer> tracer = DenmTracer::Install(NodeContainer::GetGlobal(), output);
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // without mobility models all nodes are at the event location, hence in scope
+  BOOST_REQUIRE_EQUAL(tracer->GetEvents().size(), 1);
+  const DenmTracer::Event& event = tracer->GetEvents().front();
+  BOOST_CHECK_EQUAL(event.origin, getNode("1")->GetId());
+  BOOST_CHECK_EQUAL(event.generated, Seconds(1));
+  BOOST_CHECK_EQUAL(event.targets.size(), 2);
+  BOOST_CHECK_EQUAL(event.receptions.size(), 2);
+  BOOST_CHECK_EQUAL(event.nRebroadcasts, 3); // origin, node 2 and node 3
+  BOOST_CHECK_GT(event.nRebroadcastBytes, 3 * 100);
+  BOOST_CHECK_EQUAL(event.nDuplicates, 0);
+  std::string row = "\n1\t" + std::to_string(event.origin) + "\t" + std::to_string(event.eventId) +
+                    "\t2\t2\t1\t";
+
+  tracer = nullptr; // destroy tracer, which writes the results
+  std::string results = output->str();
+  BOOST_CHECK_EQUAL(results.substr(0, results.find('\n')),
+                    "Time\tOrigin\tEventId\tTargets\tCovered\tCoverage\tLatencyP50MS\tLatencyP95MS\t"
+                    "LatencyP99MS\tUpdates\tRebroadcasts\tRebroadcastsPerCovered\tDuplicates\t"
+                    "AirtimeMS");
+  BOOST_CHECK_NE(results.find(row), std::string::npos);
+  BOOST_CHECK_NE(results.find("\n3\t-\tall\t2\t2\t1\t"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Repetitions)
+{
+  boost::filesystem::create_directories(TEST_CONFIG_PATH);
+  {
+    std::ofstream file(TEST_EVENTS.string().c_str());
+    file << "1.0,-50,0,1,0,0.25\n";
+  }
+  AppHelper producerHelper("ns3::ndn::DenmProducer");
+  producerHelper.SetAttribute("Process", StringValue("trace"));
+  producerHelper.SetAttribute("TraceFile", StringValue(TEST_EVENTS.string()));
+  producerHelper.Install(getNode("3")).Start(Seconds(0.5));
+
+  Ptr<DenmTracer> tracer = DenmTracer::Install(NodeContainer::GetGlobal(),
+                                               make_shared<std::ostringstream>());
+
+  Simulator::Stop(Seconds(3));
+  Simulator::Run();
+
+  // DENMs at 1.0s, 1.1s and 1.2s, then the termination at 1.3s, all on one row
+  BOOST_REQUIRE_EQUAL(tracer->GetEvents().size(), 2);
+  const DenmTracer::Event& event = tracer->GetEvents().back();
+  BOOST_CHECK_EQUAL(event.origin, getNode("3")->GetId());
+  BOOST_CHECK_EQUAL(event.generated, Seconds(1));
+  BOOST_CHECK_EQUAL(event.targets.size(), 2);
+  BOOST_CHECK_EQUAL(event.nUpdates, 3);
+  BOOST_CHECK_EQUAL(tracer->GetEvents().front().nUpdates, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-data-template.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/meta-info.hpp>
+
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+static shared_ptr<const ::ndn::Buffer>
+encodeTail(const Block& content, const Signature& signature)
+{
+  // Data ::= DATA-TLV TLV-LENGTH Name MetaInfo? Content? SignatureInfo SignatureValue
+  ::ndn::EncodingBuffer encoder;
+  encoder.prependBlock(signature.getValue());
+  encoder.prependBlock(signature.getInfo());
+  encoder.prependBlock(content);
+  return make_shared<const ::ndn::Buffer>(encoder.buf(), encoder.size());
+}
+
+DataTemplate::DataTemplate(size_t payloadSize, uint64_t signature, const Name& keyLocator)
+{
+  SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
+  if (keyLocator.size() > 0) {
+    signatureInfo.setKeyLocator(keyLocator);
+  }
+
+  Signature fakeSignature;
+  fakeSignature.setInfo(signatureInfo);
+  fakeSignature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, signature));
+
+  m_tail = encodeTail(Block(::ndn::tlv::Content, getZeroPayload(payloadSize)), fakeSignature);
+}
+
+DataTemplate::DataTemplate(const Data& prototype)
+  : m_tail(encodeTail(prototype.getContent(), prototype.getSignature()))
+{
+}
+
+shared_ptr<Data>
+DataTemplate::makeData(const Name& name, time::milliseconds freshnessPeriod) const
+{
+  ::ndn::MetaInfo metaInfo;
+  metaInfo.setFreshnessPeriod(freshnessPeriod);
+
+  ::ndn::EncodingEstimator estimator;
+  size_t length = m_tail->size() + metaInfo.wireEncode(estimator) + name.wireEncode(estimator);
+  size_t totalLength = length + estimator.prependVarNumber(length) +
+                       estimator.prependVarNumber(::ndn::tlv::Data);
+
+  // prepending fills the buffer from its end, so all of it is reserved in front
+  ::ndn::EncodingBuffer encoder(totalLength, 0);
+  encoder.prependByteArray(m_tail->data(), m_tail->size());
+  metaInfo.wireEncode(encoder);
+  name.wireEncode(encoder);
+  encoder.prependVarNumber(length);
+  encoder.prependVarNumber(::ndn::tlv::Data);
+
+  return make_shared<Data>(encoder.block());
+}
+
+shared_ptr<const ::ndn::Buffer>
+DataTemplate::getZeroPayload(size_t size)
+{
+  static std::map<size_t, shared_ptr<const ::ndn::Buffer>> payloads;
+
+  auto& payload = payloads[size];
+  if (payload == nullptr) {
+    payload = make_shared<const ::ndn::Buffer>(size);
+  }
+  return payload;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_DATA_TEMPLATE_HPP
+#define NDNSIM_UTILS_DATA_TEMPLATE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pre-encoded Data packet for applications that reply with virtual payloads
+ *
+ * The Content, SignatureInfo, and SignatureValue of the Data that an application produces do
+ * not change from one packet to the next. A DataTemplate encodes them once; makeData() then only
+ * encodes the Name and the MetaInfo of each packet and copies the pre-encoded part after them
+ * into a buffer of exactly the right size. The returned Data already has its wire encoding, so
+ * the forwarder does not encode it again.
+ *
+ * The buffer cannot be reused across packets, because the wire encoding of a Data is shared
+ * with every Block and ns-3 packet that refers to it until they are released.
+ */
+class DataTemplate {
+public:
+  /**
+   * @brief Create a template with a zero payload of @p payloadSize bytes and a fake signature
+   * @param payloadSize size of the virtual payload
+   * @param signature value of the fake signature; 0 is a valid signature
+   * @param keyLocator key locator of the signature, not included if empty
+   */
+  explicit
+  DataTemplate(size_t payloadSize, uint64_t signature = 0, const Name& keyLocator = Name());
+
+  /**
+   * @brief Create a template with the Content and the signature of @p prototype
+   * @pre @p prototype is signed
+   */
+  explicit
+  DataTemplate(const Data& prototype);
+
+  /**
+   * @brief Create a Data packet named @p name from the template
+   */
+  shared_ptr<Data>
+  makeData(const Name& name, time::milliseconds freshnessPeriod) const;
+
+  /**
+   * @brief Get a zero payload of @p size bytes
+   *
+   * Payloads are immutable and shared by all callers asking for the same size, so an
+   * application can set them as the Content of its Data without allocating a buffer per packet.
+   */
+  static shared_ptr<const ::ndn::Buffer>
+  getZeroPayload(size_t size);
+
+private:
+  /// Content, SignatureInfo, and SignatureValue, encoded once
+  shared_ptr<const ::ndn::Buffer> m_tail;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_DATA_TEMPLATE_HPP
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-log-histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+namespace ndn {
+
+// log2 of N_SUB_BUCKETS
+static const unsigned SUB_BUCKET_BITS = 3;
+static_assert(LogHistogram::N_SUB_BUCKETS == 1 << SUB_BUCKET_BITS, "");
+
+static unsigned
+floorLog2(uint64_t value)
+{
+  unsigned e = 0;
+  while (value >>= 1) {
+    ++e;
+  }
+  return e;
+}
+
+size_t
+LogHistogram::getIndex(uint64_t value)
+{
+  if (value < 2 * N_SUB_BUCKETS) {
+    return static_cast<size_t>(value);
+  }
+
+  // the top SUB_BUCKET_BITS bits below the leading one select the sub-bucket
+  unsigned e = floorLog2(value);
+  size_t subBucket = (value >> (e - SUB_BUCKET_BITS)) & (N_SUB_BUCKETS - 1);
+  return (e - SUB_BUCKET_BITS + 1) * N_SUB_BUCKETS + subBucket;
+}
+
+uint64_t
+LogHistogram::getLowerBound(size_t index)
+{
+  if (index < 2 * N_SUB_BUCKETS) {
+    return index;
+  }
+
+  unsigned e = static_cast<unsigned>(index / N_SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+  uint64_t subBucket = index % N_SUB_BUCKETS;
+  return (N_SUB_BUCKETS + subBucket) << (e - SUB_BUCKET_BITS);
+}
+
+void
+LogHistogram::add(uint64_t value)
+{
+  size_t index = getIndex(value);
+  if (index >= m_buckets.size()) {
+    m_buckets.resize(index + 1);
+  }
+  ++m_buckets[index];
+
+  m_min = m_count == 0 ? value : std::min(m_min, value);
+  m_max = std::max(m_max, value);
+  m_sum += value;
+  ++m_count;
+}
+
+void
+LogHistogram::merge(const LogHistogram& other)
+{
+  if (other.m_count == 0) {
+    return;
+  }
+
+  if (other.m_buckets.size() > m_buckets.size()) {
+    m_buckets.resize(other.m_buckets.size());
+  }
+  for (size_t i = 0; i < other.m_buckets.size(); ++i) {
+    m_buckets[i] += other.m_buckets[i];
+  }
+
+  m_min = m_count == 0 ? other.m_min : std::min(m_min, other.m_min);
+  m_max = std::max(m_max, other.m_max);
+  m_sum += other.m_sum;
+  m_count += other.m_count;
+}
+
+uint64_t
+LogHistogram::getQuantile(double q) const
+{
+  if (m_count == 0) {
+    return 0;
+  }
+
+  auto rank = static_cast<uint64_t>(std::ceil(std::min(std::max(q, 0.0), 1.0) * m_count));
+  rank = std::max<uint64_t>(rank, 1);
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < m_buckets.size(); ++i) {
+    seen += m_buckets[i];
+    if (seen >= rank) {
+      return std::min(getLowerBound(i + 1) - 1, m_max);
+    }
+  }
+  return m_max;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_LOG_HISTOGRAM_HPP
+#define NDNSIM_UTILS_LOG_HISTOGRAM_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Histogram of non-negative integer samples with logarithmically sized buckets
+ *
+ * Every power of two is split into N_SUB_BUCKETS buckets of equal width, so the width of a
+ * bucket is at most 1/N_SUB_BUCKETS of its lower bound, and values below 2 * N_SUB_BUCKETS have
+ * a bucket of their own. Recording a sample is a few bit operations and an increment. Only
+ * the buckets up to the largest sample are allocated; millisecond-scale latencies recorded in
+ * microseconds take about a hundred 32-bit counters.
+ */
+class LogHistogram {
+public:
+  static constexpr size_t N_SUB_BUCKETS = 8;
+
+  /**
+   * @brief Record @p value
+   */
+  void
+  add(uint64_t value);
+
+  /**
+   * @brief Add the samples of @p other
+   */
+  void
+  merge(const LogHistogram& other);
+
+  uint64_t
+  getCount() const
+  {
+    return m_count;
+  }
+
+  /**
+   * @brief Get the smallest sample, or 0 if there is none
+   */
+  uint64_t
+  getMin() const
+  {
+    return m_count == 0 ? 0 : m_min;
+  }
+
+  uint64_t
+  getMax() const
+  {
+    return m_max;
+  }
+
+  double
+  getMean() const
+  {
+    return m_count == 0 ? 0.0 : static_cast<double>(m_sum) / m_count;
+  }
+
+  /**
+   * @brief Get an upper bound of the @p q quantile
+   * @param q quantile in [0, 1]
+   * @return the upper bound of the bucket that holds the quantile, capped by the largest
+   *         sample, or 0 if there is no sample
+   */
+  uint64_t
+  getQuantile(double q) const;
+
+  /**
+   * @brief Invoke @p f for every non-empty bucket, in increasing order
+   * @tparam F `void f(uint64_t lower, uint64_t upper, uint64_t count)`, where the bucket holds
+   *           samples in [lower, upper)
+   */
+  template<typename F>
+  void
+  forEachBucket(const F& f) const
+  {
+    for (size_t i = 0; i < m_buckets.size(); ++i) {
+      if (m_buckets[i] > 0) {
+        f(getLowerBound(i), getLowerBound(i + 1), m_buckets[i]);
+      }
+    }
+  }
+
+  /**
+   * @brief Get the index of the bucket that holds @p value
+   */
+  static size_t
+  getIndex(uint64_t value);
+
+  /**
+   * @brief Get the smallest value held by bucket @p index
+   */
+  static uint64_t
+  getLowerBound(size_t index);
+
+private:
+  std::vector<uint32_t> m_buckets;
+  uint64_t m_count = 0;
+  uint64_t m_sum = 0;
+  uint64_t m_min = 0;
+  uint64_t m_max = 0;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_LOG_HISTOGRAM_HPP
@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-outstanding-interest-table.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+constexpr uint32_t OutstandingInterestTable::NONE;
+
+OutstandingInterestTable::OutstandingInterestTable(size_t initialCapacity)
+{
+  size_t capacity = 2;
+  while (capacity < initialCapacity) {
+    capacity *= 2;
+  }
+  m_slots.resize(capacity);
+}
+
+size_t
+OutstandingInterestTable::findSlot(uint32_t seq) const
+{
+  // the ring is never more than half full, so there always is a free slot to stop at
+  size_t slot = getHome(seq);
+  while (m_slots[slot].m_isUsed && m_slots[slot].seq != seq) {
+    slot = (slot + 1) & (m_slots.size() - 1);
+  }
+  return slot;
+}
+
+const OutstandingInterestTable::Entry*
+OutstandingInterestTable::find(uint32_t seq) const
+{
+  const Entry& entry = m_slots[findSlot(seq)];
+  return entry.m_isUsed ? &entry : nullptr;
+}
+
+const OutstandingInterestTable::Entry&
+OutstandingInterestTable::transmit(uint32_t seq, Time now)
+{
+  size_t slot = findSlot(seq);
+  if (!m_slots[slot].m_isUsed) {
+    if (2 * (m_size + 1) > m_slots.size()) {
+      grow();
+      slot = findSlot(seq);
+    }
+
+    Entry& entry = m_slots[slot];
+    entry.m_isUsed = true;
+    entry.seq = seq;
+    entry.firstSent = now;
+    entry.nTransmissions = 0;
+    ++m_size;
+  }
+
+  Entry& entry = m_slots[slot];
+  entry.lastSent = now;
+  ++entry.nTransmissions;
+  if (!entry.m_isArmed) {
+    entry.armedAt = now;
+    link(slot);
+  }
+  return entry;
+}
+
+uint32_t
+OutstandingInterestTable::disarmEarliest()
+{
+  BOOST_ASSERT(m_head != NONE);
+
+  uint32_t slot = m_head;
+  unlink(slot);
+  return m_slots[slot].seq;
+}
+
+void
+OutstandingInterestTable::erase(uint32_t seq)
+{
+  size_t hole = findSlot(seq);
+  if (!m_slots[hole].m_isUsed) {
+    return;
+  }
+
+  if (m_slots[hole].m_isArmed) {
+    unlink(hole);
+  }
+  m_slots[hole].m_isUsed = false;
+  --m_size;
+
+  // shift back the entries of the same probe run that can no longer be reached past the hole
+  size_t mask = m_slots.size() - 1;
+  for (size_t slot = (hole + 1) & mask; m_slots[slot].m_isUsed; slot = (slot + 1) & mask) {
+    size_t home = getHome(m_slots[slot].seq);
+    if (((slot - home) & mask) < ((slot - hole) & mask)) {
+      continue; // home lies between the hole and the slot
+    }
+
+    Entry& entry = m_slots[slot];
+    m_slots[hole] = entry;
+    if (entry.m_isArmed) {
+      (entry.m_prev == NONE ? m_head : m_slots[entry.m_prev].m_next) = hole;
+      (entry.m_next == NONE ? m_tail : m_slots[entry.m_next].m_prev) = hole;
+    }
+    entry.m_isUsed = false;
+    entry.m_isArmed = false;
+    hole = slot;
+  }
+}
+
+void
+OutstandingInterestTable::link(size_t slot)
+{
+  Entry& entry = m_slots[slot];
+  entry.m_isArmed = true;
+  entry.m_prev = m_tail;
+  entry.m_next = NONE;
+  (m_tail == NONE ? m_head : m_slots[m_tail].m_next) = slot;
+  m_tail = slot;
+}
+
+void
+OutstandingInterestTable::unlink(size_t slot)
+{
+  Entry& entry = m_slots[slot];
+  (entry.m_prev == NONE ? m_head : m_slots[entry.m_prev].m_next) = entry.m_next;
+  (entry.m_next == NONE ? m_tail : m_slots[entry.m_next].m_prev) = entry.m_prev;
+  entry.m_isArmed = false;
+}
+
+void
+OutstandingInterestTable::grow()
+{
+  std::vector<Entry> old(m_slots.size() * 2);
+  old.swap(m_slots);
+
+  // re-link the armed entries in their original order while moving them
+  uint32_t armed = m_head;
+  m_head = m_tail = NONE;
+  for (; armed != NONE; armed = old[armed].m_next) {
+    size_t slot = findSlot(old[armed].seq);
+    m_slots[slot] = old[armed];
+    link(slot);
+  }
+
+  for (const Entry& entry : old) {
+    if (entry.m_isUsed && !entry.m_isArmed) {
+      size_t slot = findSlot(entry.seq);
+      m_slots[slot] = entry;
+    }
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
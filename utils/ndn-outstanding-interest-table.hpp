@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_OUTSTANDING_INTEREST_TABLE_HPP
+#define NDNSIM_UTILS_OUTSTANDING_INTEREST_TABLE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/nstime.h"
+
+#include <limits>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Consumer-side table of Interests that have been sent but not yet satisfied
+ *
+ * Entries live in a flat ring indexed by sequence number (open addressing with linear probing),
+ * so the consecutive sequence numbers of a window map to consecutive slots without collisions.
+ * The ring doubles when it becomes half full and never shrinks.
+ *
+ * Entries whose retransmission timer is armed are threaded on an intrusive list in the order
+ * they were armed. As every timer is armed at the current time and all of them share the
+ * consumer's RTO, this order is also the order of their deadlines, so the earliest deadline is
+ * always at the head of the list.
+ */
+class OutstandingInterestTable : boost::noncopyable {
+public:
+  class Entry {
+  public:
+    uint32_t seq;
+    Time firstSent;          ///< first transmission, reported by FirstInterestDataDelay
+    Time lastSent;           ///< last transmission, reported by LastRetransmittedInterestDataDelay
+    Time armedAt;            ///< when the retransmission timer was armed
+    uint32_t nTransmissions; ///< number of transmissions so far
+
+  private:
+    bool m_isUsed = false;
+    bool m_isArmed = false;
+    uint32_t m_prev = NONE;
+    uint32_t m_next = NONE;
+
+    friend class OutstandingInterestTable;
+  };
+
+  explicit
+  OutstandingInterestTable(size_t initialCapacity = 16);
+
+  /**
+   * @brief Find the entry of @p seq
+   * @return the entry, or nullptr if @p seq is not outstanding
+   */
+  const Entry*
+  find(uint32_t seq) const;
+
+  /**
+   * @brief Record a transmission of @p seq at @p now
+   *
+   * Creates the entry if @p seq is not outstanding, and arms its retransmission timer unless it
+   * is already armed.
+   * @pre @p now is not earlier than in any previous call
+   */
+  const Entry&
+  transmit(uint32_t seq, Time now);
+
+  /**
+   * @brief Get the entry whose retransmission timer was armed first
+   * @return the entry, or nullptr if no timer is armed
+   */
+  const Entry*
+  getEarliestArmed() const
+  {
+    return m_head == NONE ? nullptr : &m_slots[m_head];
+  }
+
+  /**
+   * @brief Disarm the timer of getEarliestArmed(), keeping its entry
+   * @return sequence number of the disarmed entry
+   * @pre getEarliestArmed() != nullptr
+   */
+  uint32_t
+  disarmEarliest();
+
+  /**
+   * @brief Remove the entry of @p seq, if any
+   */
+  void
+  erase(uint32_t seq);
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  size_t
+  getCapacity() const
+  {
+    return m_slots.size();
+  }
+
+private:
+  size_t
+  getHome(uint32_t seq) const
+  {
+    return seq & (m_slots.size() - 1);
+  }
+
+  size_t
+  findSlot(uint32_t seq) const;
+
+  void
+  link(size_t slot);
+
+  void
+  unlink(size_t slot);
+
+  void
+  grow();
+
+private:
+  static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+  std::vector<Entry> m_slots;
+  size_t m_size = 0;
+  uint32_t m_head = NONE;
+  uint32_t m_tail = NONE;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_OUTSTANDING_INTEREST_TABLE_HPP
@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-zipf-mandelbrot-sampler.hpp"
+
+#include <cmath>
+#include <map>
+#include <tuple>
+
+namespace ns3 {
+namespace ndn {
+
+shared_ptr<const ZipfMandelbrotSampler>
+ZipfMandelbrotSampler::get(uint32_t n, double q, double s)
+{
+  static std::map<std::tuple<uint32_t, double, double>, std::weak_ptr<const ZipfMandelbrotSampler>> samplers;
+
+  auto& cached = samplers[std::make_tuple(n, q, s)];
+  auto sampler = cached.lock();
+  if (sampler != nullptr) {
+    return sampler;
+  }
+
+  // drop the entries of samplers nobody holds any more
+  for (auto it = samplers.begin(); it != samplers.end();) {
+    if (it->second.expired() && &it->second != &cached) {
+      it = samplers.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  sampler = make_shared<const ZipfMandelbrotSampler>(n, q, s);
+  cached = sampler;
+  return sampler;
+}
+
+ZipfMandelbrotSampler::ZipfMandelbrotSampler(uint32_t n, double q, double s)
+  : m_q(q)
+  , m_s(s)
+  , m_sum(0.0)
+  , m_prob(n)
+  , m_alias(n)
+{
+  BOOST_ASSERT(n > 0);
+
+  for (uint32_t k = 1; k <= n; ++k) {
+    m_sum += 1.0 / std::pow(k + q, s);
+  }
+
+  // scale the probabilities so that their mean is 1, then pair every column below 1
+  // with a column above 1 that tops it up
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  for (uint32_t i = 0; i < n; ++i) {
+    m_prob[i] = n / (std::pow(i + 1 + q, s) * m_sum);
+    (m_prob[i] < 1.0 ? small : large).push_back(i);
+  }
+
+  while (!small.empty() && !large.empty()) {
+    uint32_t less = small.back();
+    small.pop_back();
+    uint32_t more = large.back();
+
+    m_alias[less] = more;
+    m_prob[more] -= 1.0 - m_prob[less];
+    if (m_prob[more] < 1.0) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+
+  // what remains is 1 up to rounding errors
+  for (uint32_t i : small) {
+    m_prob[i] = 1.0;
+  }
+  for (uint32_t i : large) {
+    m_prob[i] = 1.0;
+  }
+}
+
+double
+ZipfMandelbrotSampler::getProbability(uint32_t k) const
+{
+  if (k < 1 || k > m_prob.size()) {
+    return 0.0;
+  }
+  return 1.0 / (std::pow(k + m_q, m_s) * m_sum);
+}
+
+} // namespace ndn
+} // namespace ns3
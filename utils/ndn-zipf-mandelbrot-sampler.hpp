@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_ZIPF_MANDELBROT_SAMPLER_HPP
+#define NDNSIM_UTILS_ZIPF_MANDELBROT_SAMPLER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Samples ranks 1..N with probability proportional to 1 / (k + q)^s
+ *
+ * The sampler is an alias table (Vose's method), built in O(N) time and sampled in O(1) time
+ * from a single uniform random number. A table is immutable once built, so get() shares one
+ * table among all users that ask for the same (N, q, s), for as long as one of them holds it.
+ */
+class ZipfMandelbrotSampler : boost::noncopyable {
+public:
+  /**
+   * @brief Get the sampler for (@p n, @p q, @p s), building it if no one holds it
+   * @pre n > 0
+   */
+  static shared_ptr<const ZipfMandelbrotSampler>
+  get(uint32_t n, double q, double s);
+
+  ZipfMandelbrotSampler(uint32_t n, double q, double s);
+
+  /**
+   * @brief Map a uniform random number @p u in [0, 1) to a rank in [1, N]
+   */
+  uint32_t
+  sample(double u) const
+  {
+    double x = u * m_prob.size();
+    auto column = std::min(static_cast<size_t>(x), m_prob.size() - 1);
+    return 1 + (x - column < m_prob[column] ? static_cast<uint32_t>(column) : m_alias[column]);
+  }
+
+  uint32_t
+  getN() const
+  {
+    return static_cast<uint32_t>(m_prob.size());
+  }
+
+  /**
+   * @brief Get the probability of rank @p k
+   */
+  double
+  getProbability(uint32_t k) const;
+
+private:
+  double m_q;
+  double m_s;
+  double m_sum; ///< sum of the weights 1 / (k + q)^s
+  std::vector<double> m_prob;
+  std::vector<uint32_t> m_alias;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_ZIPF_MANDELBROT_SAMPLER_HPP
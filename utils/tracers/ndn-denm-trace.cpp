@@ -0,0 +1,192 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-denm-trace.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+NS_LOG_COMPONENT_DEFINE("ndn.DenmTrace");
+
+namespace ns3 {
+namespace ndn {
+
+namespace {
+
+const char MAGIC[8] = {'N', 'D', 'N', 'D', 'E', 'N', 'M', '\0'};
+const uint32_t FORMAT_VERSION = 1;
+
+struct FileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+};
+
+class Sink
+{
+public:
+  ~Sink()
+  {
+    flush();
+  }
+
+  void
+  flush()
+  {
+    os.write(buffer.data(), used);
+    used = 0;
+  }
+
+public:
+  std::ofstream os;
+  std::vector<char> buffer;
+  size_t used = 0;
+};
+
+std::unique_ptr<Sink> g_sink;
+
+} // namespace
+
+DenmTrace::Level DenmTrace::s_level = DenmTrace::LEVEL_NONE;
+
+void
+DenmTrace::Open(const std::string& file, Level level, size_t bufferSize)
+{
+  Close();
+
+  auto sink = std::make_unique<Sink>();
+  sink->os.open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  if (!sink->os.is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return;
+  }
+
+  FileHeader header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = FORMAT_VERSION;
+  header.recordSize = sizeof(DenmTraceRecord);
+  sink->os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  sink->buffer.resize(std::max(bufferSize, sizeof(DenmTraceRecord)));
+  g_sink = std::move(sink);
+  s_level = level;
+}
+
+void
+DenmTrace::Close()
+{
+  s_level = LEVEL_NONE;
+  g_sink.reset();
+}
+
+void
+DenmTrace::SetLevel(Level level)
+{
+  if (g_sink != nullptr) {
+    s_level = level;
+  }
+}
+
+DenmTrace::Level
+DenmTrace::GetDecisionLevel(Decision decision)
+{
+  switch (decision) {
+    case Decision::PRODUCED:
+    case Decision::CONSUMED:
+      return LEVEL_APP;
+    case Decision::SCHEDULED:
+    case Decision::SUPPRESSED:
+    case Decision::CANCELLED:
+    case Decision::REBROADCAST:
+    case Decision::DEFERRED:
+    case Decision::THROTTLED:
+      return LEVEL_DECISION;
+    case Decision::DUPLICATE:
+    case Decision::OUT_OF_SCOPE:
+      return LEVEL_ALL;
+  }
+  return LEVEL_ALL;
+}
+
+void
+DenmTrace::Append(uint32_t node, Decision decision, uint64_t eventId, double distance,
+                  time::nanoseconds timer)
+{
+  DenmTraceRecord record;
+  record.eventId = eventId;
+  record.time = Simulator::Now().GetNanoSeconds();
+  record.timer = timer.count() < 0 ? -1 : timer.count();
+  record.distance = distance;
+  record.node = node;
+  record.decision = static_cast<uint8_t>(decision);
+  std::memset(record.reserved, 0, sizeof(record.reserved));
+
+  Sink& sink = *g_sink;
+  if (sink.used + sizeof(record) > sink.buffer.size()) {
+    sink.flush();
+  }
+  std::memcpy(sink.buffer.data() + sink.used, &record, sizeof(record));
+  sink.used += sizeof(record);
+}
+
+size_t
+DenmTrace::ConvertToCsv(const std::string& file, std::ostream& os)
+{
+  std::ifstream is(file.c_str(), std::ios_base::in | std::ios_base::binary);
+  if (!is.is_open()) {
+    throw std::runtime_error("File " + file + " cannot be opened for reading");
+  }
+
+  FileHeader header;
+  if (!is.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw std::runtime_error("File " + file + " is not a DENM trace");
+  }
+  if (header.version != FORMAT_VERSION || header.recordSize != sizeof(DenmTraceRecord)) {
+    throw std::runtime_error("File " + file + " has unsupported trace format version " +
+                             std::to_string(header.version));
+  }
+
+  os << "TimeNS,Node,EventId,Decision,Distance,TimerNS\n";
+
+  size_t nRecords = 0;
+  DenmTraceRecord record;
+  while (is.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+    os << record.time << ','
+       << record.node << ','
+       << record.eventId << ','
+       << static_cast<Decision>(record.decision) << ','
+       << record.distance << ',';
+    if (record.timer >= 0) {
+      os << record.timer;
+    }
+    os << '\n';
+    ++nRecords;
+  }
+  return nRecords;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_DENM_TRACE_HPP
+#define NDN_DENM_TRACE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-decision.hpp"
+
+#include <iosfwd>
+#include <type_traits>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Fixed-size binary record of a DENM event, as written by DenmTrace
+ *
+ * Records are written in host byte order and read back on the same kind of machine.
+ */
+struct DenmTraceRecord
+{
+  uint64_t eventId;    ///< hash of the DENM name, nfd::PendingRebroadcastTable::computeKey
+  int64_t time;        ///< simulation time, in nanoseconds
+  int64_t timer;       ///< rebroadcast delay in nanoseconds, or -1 if not applicable
+  double distance;     ///< distance between the node and the event, in meters
+  uint32_t node;       ///< ns-3 node id
+  uint8_t decision;    ///< nfd::fw::DenmDecision
+  uint8_t reserved[3];
+};
+
+static_assert(sizeof(DenmTraceRecord) == 40, "DenmTraceRecord must not contain padding");
+static_assert(std::is_trivially_copyable<DenmTraceRecord>::value,
+              "DenmTraceRecord must be trivially copyable");
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Binary trace sink for DENM forwarding and application events
+ *
+ * All nodes of a run share one sink. Records are copied into a memory buffer, which is
+ * written out when full and when the sink is closed, so recording an event costs a level
+ * check and a memcpy. Use ConvertToCsv to turn a trace file into text for post-processing.
+ *
+ * The following should be put just before calling Simulator::Run in the scenario:
+ *
+ *     DenmTrace::Open("denm-trace.bin", DenmTrace::LEVEL_DECISION);
+ *     Simulator::Run();
+ *     DenmTrace::Close();
+ */
+class DenmTrace
+{
+public:
+  /**
+   * @brief How much detail is recorded
+   */
+  enum Level : uint8_t {
+    LEVEL_NONE = 0,     ///< nothing is recorded
+    LEVEL_APP = 1,      ///< DENMs produced and consumed by applications
+    LEVEL_DECISION = 2, ///< additionally, rebroadcasts scheduled, suppressed, cancelled and sent,
+                        ///< and rebroadcasts deferred or throttled by congestion control
+    LEVEL_ALL = 3       ///< additionally, duplicates and out-of-scope DENMs
+  };
+
+  using Decision = ::nfd::fw::DenmDecision;
+
+  /**
+   * @brief Open the trace file, replacing a trace that is already open
+   *
+   * @param file File to which records will be written
+   * @param level Most detailed level that is recorded
+   * @param bufferSize Size of the memory buffer, in bytes
+   */
+  static void
+  Open(const std::string& file, Level level = LEVEL_DECISION, size_t bufferSize = 1 << 20);
+
+  /**
+   * @brief Flush buffered records and close the trace file
+   */
+  static void
+  Close();
+
+  /**
+   * @brief Change the level at runtime
+   *
+   * Has no effect unless a trace file is open.
+   */
+  static void
+  SetLevel(Level level);
+
+  static Level
+  GetLevel()
+  {
+    return s_level;
+  }
+
+  static bool
+  IsEnabled(Decision decision)
+  {
+    return s_level >= GetDecisionLevel(decision);
+  }
+
+  /**
+   * @brief Record an event, if @p decision is enabled
+   *
+   * @param timer Rebroadcast delay, or a negative value if not applicable
+   */
+  static void
+  Record(uint32_t node, Decision decision, uint64_t eventId, double distance,
+         time::nanoseconds timer = time::nanoseconds(-1))
+  {
+    if (IsEnabled(decision)) {
+      Append(node, decision, eventId, distance, timer);
+    }
+  }
+
+  static Level
+  GetDecisionLevel(Decision decision);
+
+  /**
+   * @brief Convert a binary trace file into comma-separated values with a header row
+   *
+   * @return number of records converted
+   * @throw std::runtime_error the file cannot be opened or is not a DENM trace
+   */
+  static size_t
+  ConvertToCsv(const std::string& file, std::ostream& os);
+
+private:
+  static void
+  Append(uint32_t node, Decision decision, uint64_t eventId, double distance,
+         time::nanoseconds timer);
+
+private:
+  static Level s_level;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_DENM_TRACE_HPP
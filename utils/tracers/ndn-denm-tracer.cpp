@@ -0,0 +1,350 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-denm-tracer.hpp"
+
+#include "ns3/node.h"
+#include "ns3/config.h"
+#include "ns3/callback.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+
+#include "apps/ndn-app.hpp"
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-position-cache.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-geo-strategy.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-name.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pending-rebroadcast-table.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.DenmTracer");
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::fw::DenmDecision;
+
+static std::list<Ptr<DenmTracer>> g_denmTracers;
+static bool g_isDestroyScheduled = false;
+
+void
+DenmTracer::Destroy()
+{
+  g_denmTracers.clear();
+  g_isDestroyScheduled = false;
+}
+
+void
+DenmTracer::InstallAll(const std::string& file, DataRate phyRate)
+{
+  Install(NodeContainer::GetGlobal(), file, phyRate);
+}
+
+void
+DenmTracer::Install(const NodeContainer& nodes, const std::string& file, DataRate phyRate)
+{
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  g_denmTracers.push_back(Install(nodes, outputStream, phyRate));
+
+  // results are written at the end of the run
+  if (!g_isDestroyScheduled) {
+    Simulator::ScheduleDestroy(&DenmTracer::Destroy);
+    g_isDestroyScheduled = true;
+  }
+}
+
+Ptr<DenmTracer>
+DenmTracer::Install(const NodeContainer& nodes, shared_ptr<std::ostream> outputStream,
+                    DataRate phyRate)
+{
+  NS_LOG_DEBUG("Nodes: " << nodes.GetN());
+
+  return Create<DenmTracer>(outputStream, nodes, phyRate);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+DenmTracer::DenmTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes, DataRate phyRate)
+  : m_os(os)
+  , m_nodes(nodes)
+  , m_phyRate(phyRate)
+{
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); node++) {
+    Connect(*node);
+  }
+}
+
+DenmTracer::~DenmTracer()
+{
+  if (m_os != nullptr) {
+    PrintHeader(*m_os);
+    *m_os << "\n";
+    Print(*m_os);
+    m_os->flush();
+  }
+}
+
+void
+DenmTracer::Connect(Ptr<Node> node)
+{
+  Ptr<L3Protocol> l3 = node->GetObject<L3Protocol>();
+  if (l3 == nullptr) {
+    return;
+  }
+
+  m_probes.push_back(Probe{this, node->GetId()});
+  l3->TraceConnectWithoutContext("DenmDecisions",
+                                 MakeCallback(&Probe::OnDenmDecision, &m_probes.back()));
+
+  Config::ConnectWithoutContext("/NodeList/" + boost::lexical_cast<std::string>(node->GetId())
+                                  + "/ApplicationList/*/TransmittedDatas",
+                                MakeCallback(&DenmTracer::TransmittedData, this));
+}
+
+void
+DenmTracer::Probe::OnDenmDecision(const Name& dataName, DenmDecision decision, time::nanoseconds)
+{
+  tracer->OnDenmDecision(node, dataName, decision);
+}
+
+/**
+ * @return identity of the event of @p denm, which all its sequence numbers share
+ */
+static uint64_t
+computeEventId(const nfd::fw::DenmName& denm)
+{
+  size_t seed = 0;
+  boost::hash_combine(seed, denm.appType);
+  boost::hash_combine(seed, denm.contentType);
+  boost::hash_combine(seed, denm.eventX);
+  boost::hash_combine(seed, denm.eventY);
+  boost::hash_combine(seed, denm.eventTime.count());
+  return seed;
+}
+
+void
+DenmTracer::TransmittedData(shared_ptr<const Data> data, Ptr<App> app, shared_ptr<Face>)
+{
+  auto denmTag = nfd::fw::getDenmName(*data);
+  if (denmTag == nullptr) {
+    return;
+  }
+  uint64_t messageKey = nfd::PendingRebroadcastTable::computeKey(data->getName());
+  if (m_messages.count(messageKey) > 0) {
+    return;
+  }
+
+  const nfd::fw::DenmName& denm = denmTag->get();
+  uint64_t eventId = computeEventId(denm);
+  auto it = m_eventIndex.find(eventId);
+  if (it != m_eventIndex.end()) {
+    // a repetition or the termination is followed against the targets of the first DENM
+    m_messages.emplace(messageKey, Message{it->second, data->wireEncode().size()});
+    ++m_events[it->second].nUpdates;
+    return;
+  }
+
+  Ptr<Node> origin = app->GetNode();
+  m_eventIndex.emplace(eventId, m_events.size());
+  m_messages.emplace(messageKey, Message{m_events.size(), data->wireEncode().size()});
+  m_events.emplace_back();
+  Event& event = m_events.back();
+  event.eventId = eventId;
+  event.origin = origin->GetId();
+  event.generated = Simulator::Now();
+
+  // the scope is the one configured on the producer node
+  const nfd::DenmScopeTable::Scope* scope = L3Protocol::getL3Protocol(origin)->getForwarder()
+    ->getDenmScopeTable().find(denm.appType, denm.contentType, denm.eventX, denm.eventY);
+  if (scope == nullptr) {
+    return;
+  }
+
+  for (NodeContainer::Iterator node = m_nodes.Begin(); node != m_nodes.End(); node++) {
+    Ptr<L3Protocol> l3 = (*node)->GetObject<L3Protocol>();
+    if ((*node)->GetId() == event.origin || l3 == nullptr) {
+      continue;
+    }
+    Vector position = l3->getPositionCache().getPosition();
+    if (nfd::fw::DenmGeoStrategy::isInScope(denm, *scope, position)) {
+      event.targets.push_back((*node)->GetId());
+    }
+  }
+  std::sort(event.targets.begin(), event.targets.end());
+  NS_LOG_DEBUG("DENM " << eventId << " from node " << event.origin << ", "
+               << event.targets.size() << " nodes in scope");
+}
+
+void
+DenmTracer::OnDenmDecision(uint32_t node, const Name& dataName, DenmDecision decision)
+{
+  auto it = m_messages.find(nfd::PendingRebroadcastTable::computeKey(dataName));
+  if (it == m_messages.end()) {
+    return;
+  }
+  const Message& message = it->second;
+  Event& event = m_events[message.event];
+
+  switch (decision) {
+    case DenmDecision::SCHEDULED:
+    case DenmDecision::SUPPRESSED:
+      if (node != event.origin) {
+        event.receptions.emplace(node, Simulator::Now());
+      }
+      break;
+    case DenmDecision::REBROADCAST:
+      ++event.nRebroadcasts;
+      // every hop rebroadcasts the Data it received, unchanged
+      event.nRebroadcastBytes += message.dataSize;
+      break;
+    case DenmDecision::CANCELLED:
+    case DenmDecision::DUPLICATE:
+      ++event.nDuplicates;
+      break;
+    default:
+      break;
+  }
+}
+
+void
+DenmTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+     << "Origin"
+     << "\t"
+     << "EventId"
+     << "\t"
+     << "Targets"
+     << "\t"
+     << "Covered"
+     << "\t"
+     << "Coverage"
+     << "\t"
+     << "LatencyP50MS"
+     << "\t"
+     << "LatencyP95MS"
+     << "\t"
+     << "LatencyP99MS"
+     << "\t"
+     << "Updates"
+     << "\t"
+     << "Rebroadcasts"
+     << "\t"
+     << "RebroadcastsPerCovered"
+     << "\t"
+     << "Duplicates"
+     << "\t"
+     << "AirtimeMS";
+}
+
+static double
+getPercentile(const std::vector<Time>& sorted, double p)
+{
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  // nearest-rank percentile
+  size_t rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+  return sorted[std::max<size_t>(rank, 1) - 1].ToDouble(Time::MS);
+}
+
+void
+DenmTracer::PrintRow(std::ostream& os, const std::string& eventId, const std::string& origin,
+                     double generated, size_t nTargets, std::vector<Time>& latencies,
+                     uint32_t nUpdates, uint32_t nRebroadcasts, uint32_t nDuplicates,
+                     uint64_t nRebroadcastBytes) const
+{
+  std::sort(latencies.begin(), latencies.end());
+  size_t nCovered = latencies.size();
+  double airtime = static_cast<double>(nRebroadcastBytes) * 8 / m_phyRate.GetBitRate();
+
+  os << generated << "\t" << origin << "\t" << eventId << "\t" << nTargets << "\t" << nCovered
+     << "\t" << (nTargets > 0 ? static_cast<double>(nCovered) / nTargets : 0.0)
+     << "\t" << getPercentile(latencies, 0.50)
+     << "\t" << getPercentile(latencies, 0.95)
+     << "\t" << getPercentile(latencies, 0.99)
+     << "\t" << nUpdates
+     << "\t" << nRebroadcasts
+     << "\t" << (nCovered > 0 ? static_cast<double>(nRebroadcasts) / nCovered : 0.0)
+     << "\t" << nDuplicates
+     << "\t" << airtime * 1000 << "\n";
+}
+
+void
+DenmTracer::Print(std::ostream& os) const
+{
+  size_t nTargets = 0;
+  std::vector<Time> allLatencies;
+  uint32_t nUpdates = 0;
+  uint32_t nRebroadcasts = 0;
+  uint32_t nDuplicates = 0;
+  uint64_t nRebroadcastBytes = 0;
+
+  for (const Event& event : m_events) {
+    std::vector<Time> latencies;
+    for (uint32_t node : event.targets) {
+      auto reception = event.receptions.find(node);
+      if (reception != event.receptions.end()) {
+        latencies.push_back(reception->second - event.generated);
+      }
+    }
+    allLatencies.insert(allLatencies.end(), latencies.begin(), latencies.end());
+    nTargets += event.targets.size();
+    nUpdates += event.nUpdates;
+    nRebroadcasts += event.nRebroadcasts;
+    nDuplicates += event.nDuplicates;
+    nRebroadcastBytes += event.nRebroadcastBytes;
+
+    PrintRow(os, boost::lexical_cast<std::string>(event.eventId),
+             boost::lexical_cast<std::string>(event.origin), event.generated.ToDouble(Time::S),
+             event.targets.size(), latencies, event.nUpdates, event.nRebroadcasts,
+             event.nDuplicates, event.nRebroadcastBytes);
+  }
+
+  PrintRow(os, "all", "-", Simulator::Now().ToDouble(Time::S), nTargets, allLatencies,
+           nUpdates, nRebroadcasts, nDuplicates, nRebroadcastBytes);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,186 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_DENM_TRACER_HPP
+#define NDN_DENM_TRACER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/denm-decision.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/data-rate.h"
+#include "ns3/node-container.h"
+
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+class App;
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer of DENM dissemination, aggregated per DENM event
+ *
+ * A DENM event is identified by the application type, content type, position and time of the
+ * event, so that its repetitions and its termination, which differ only in sequence number,
+ * share one row. When a producer application sends the first DENM of an event, the tracer
+ * records the nodes that lie within the scope of the event at that time. It then follows the
+ * decisions of the denm-geo strategy on all traced nodes, for every DENM of the event.
+ * At the end of the run, it writes one row per DENM event with:
+ * - coverage: the fraction of in-scope nodes that accepted the DENM
+ * - p50/p95/p99 latency between generation and first acceptance at covered nodes
+ * - updates: later DENMs of the event sent by its origin, including the termination
+ * - rebroadcasts, rebroadcasts per covered node, and overheard duplicates
+ * - airtime spent on rebroadcasts at the given PHY rate
+ *
+ * A final row with the EventId "all" aggregates every DENM event. Nothing is written per packet.
+ */
+class DenmTracer : public SimpleRefCount<DenmTracer> {
+public:
+  /**
+   * @brief Helper method to install the tracer on all simulation nodes
+   *
+   * @param file File to which the results will be written.  If filename is -, then std::out is used
+   * @param phyRate PHY rate used to convert rebroadcast bytes into airtime
+   */
+  static void
+  InstallAll(const std::string& file, DataRate phyRate = DataRate("6Mbps"));
+
+  /**
+   * @brief Helper method to install the tracer on the selected simulation nodes
+   *
+   * Only DENMs produced on, and decisions made by, @p nodes are traced.
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file,
+          DataRate phyRate = DataRate("6Mbps"));
+
+  /**
+   * @brief Helper method to install the tracer on the selected simulation nodes
+   *
+   * Results are written to @p outputStream when the tracer is destroyed.
+   */
+  static Ptr<DenmTracer>
+  Install(const NodeContainer& nodes, shared_ptr<std::ostream> outputStream,
+          DataRate phyRate = DataRate("6Mbps"));
+
+  /**
+   * @brief Write the results of, and remove, all statically created tracers
+   *
+   * Called automatically by Simulator::Destroy.
+   */
+  static void
+  Destroy();
+
+  DenmTracer(shared_ptr<std::ostream> os, const NodeContainer& nodes, DataRate phyRate);
+
+  /**
+   * @brief Destructor, writes the results
+   */
+  ~DenmTracer();
+
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print one row per DENM event, and the aggregate row
+   */
+  void
+  Print(std::ostream& os) const;
+
+public:
+  /**
+   * @brief Dissemination of one DENM event
+   */
+  struct Event
+  {
+    uint64_t eventId;
+    uint32_t origin;
+    Time generated; ///< when the first DENM of the event was sent
+    std::vector<uint32_t> targets; ///< sorted ids of the nodes in scope at generation
+    std::map<uint32_t, Time> receptions; ///< first acceptance of each node
+    uint32_t nUpdates = 0; ///< later DENMs sent by the origin, including the termination
+    uint32_t nRebroadcasts = 0;
+    uint32_t nDuplicates = 0;
+    uint64_t nRebroadcastBytes = 0;
+  };
+
+  const std::vector<Event>&
+  GetEvents() const
+  {
+    return m_events;
+  }
+
+private:
+  struct Probe
+  {
+    void
+    OnDenmDecision(const Name& dataName, nfd::fw::DenmDecision decision, time::nanoseconds delay);
+
+    DenmTracer* tracer;
+    uint32_t node;
+  };
+
+  void
+  Connect(Ptr<Node> node);
+
+  void
+  TransmittedData(shared_ptr<const Data> data, Ptr<App> app, shared_ptr<Face> face);
+
+  void
+  OnDenmDecision(uint32_t node, const Name& dataName, nfd::fw::DenmDecision decision);
+
+  void
+  PrintRow(std::ostream& os, const std::string& eventId, const std::string& origin,
+           double generated, size_t nTargets, std::vector<Time>& latencies, uint32_t nUpdates,
+           uint32_t nRebroadcasts, uint32_t nDuplicates, uint64_t nRebroadcastBytes) const;
+
+  /**
+   * @brief A DENM of a traced event
+   */
+  struct Message
+  {
+    size_t event; ///< index of the event in m_events
+    size_t dataSize; ///< size of the DENM Data as generated
+  };
+
+private:
+  shared_ptr<std::ostream> m_os;
+  NodeContainer m_nodes;
+  DataRate m_phyRate;
+  std::list<Probe> m_probes;
+
+  std::vector<Event> m_events;
+  std::unordered_map<uint64_t, size_t> m_eventIndex; ///< event identity to index in m_events
+  std::unordered_map<uint64_t, Message> m_messages; ///< PendingRebroadcastTable key of each DENM
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_DENM_TRACER_HPP